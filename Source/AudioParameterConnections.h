@@ -192,249 +192,248 @@ m_value_tree_osc.addListener(&m_non_param_listener_osc);
 
 for (int osc = 0; osc < 3; ++osc) {
 	//osc pitch listener:
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_oct", &m_tree_listener_osc_pitch);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_semi", &m_tree_listener_osc_pitch);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_fine", &m_tree_listener_osc_pitch);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_oct", m_tree_listener_osc_pitch);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_semi", m_tree_listener_osc_pitch);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_fine", m_tree_listener_osc_pitch);
 
 	//osc misc listener:
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_vol", &m_tree_listener_osc_misc);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_vol", m_tree_listener_osc_misc);
 	if (osc != 0) {
-		m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_sync", &m_tree_listener_osc_misc);
+		listenToParameter("osc" + std::to_string(osc + 1) + "_sync", m_tree_listener_osc_misc);
 	}
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_reset", &m_tree_listener_osc_misc);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_reset", m_tree_listener_osc_misc);
 
 	//osc analog listener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_pulsewidth", &m_tree_listener_osc_analog);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_drift", &m_tree_listener_osc_analog);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_pulsewidth", m_tree_listener_osc_analog);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_drift", m_tree_listener_osc_analog);
 
 	//osc multi listener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_position", &m_tree_listener_osc_multi);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_detune", &m_tree_listener_osc_multi);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_pos_mod", &m_tree_listener_osc_multi);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_multi_position", &m_tree_listener_osc_multi);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_spread", &m_tree_listener_osc_multi);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_position", m_tree_listener_osc_multi);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_detune", m_tree_listener_osc_multi);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_pos_mod", m_tree_listener_osc_multi);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_multi_position", m_tree_listener_osc_multi);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_spread", m_tree_listener_osc_multi);
 
 	//osc xy listener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_vec_x", &m_tree_listener_osc_xy);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_vec_y", &m_tree_listener_osc_xy);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_vec_x", m_tree_listener_osc_xy);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_vec_y", m_tree_listener_osc_xy);
 
 	//osc chip listener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_chipnoise", &m_tree_listener_osc_chip);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_arp_speed", &m_tree_listener_osc_chip);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_arp_on", &m_tree_listener_osc_chip);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_chipnoise", m_tree_listener_osc_chip);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_arp_speed", m_tree_listener_osc_chip);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_arp_on", m_tree_listener_osc_chip);
 
 	//osc arp listener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_step_1", &m_tree_listener_osc_arp);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_step_2", &m_tree_listener_osc_arp);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_step_3", &m_tree_listener_osc_arp);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_step_3_on", &m_tree_listener_osc_arp);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_step_1", m_tree_listener_osc_arp);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_step_2", m_tree_listener_osc_arp);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_step_3", m_tree_listener_osc_arp);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_step_3_on", m_tree_listener_osc_arp);
 
 	//osc fm listener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_fm", &m_tree_listener_osc_fm);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_exp_fm", &m_tree_listener_osc_fm);
-	//m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_carrier_ratio", &m_tree_listener_osc_fm);
-	//m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_modulator_ratio", &m_tree_listener_osc_fm);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_fm", m_tree_listener_osc_fm);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_exp_fm", m_tree_listener_osc_fm);
+	//listenToParameter("osc" + std::to_string(osc + 1) + "_carrier_ratio", m_tree_listener_osc_fm);
+	//listenToParameter("osc" + std::to_string(osc + 1) + "_modulator_ratio", m_tree_listener_osc_fm);
 
 	//osc noiselistener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_lp", &m_tree_listener_osc_noise);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_hp", &m_tree_listener_osc_noise);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_lp", m_tree_listener_osc_noise);
+	listenToParameter("osc" + std::to_string(osc + 1) + "_hp", m_tree_listener_osc_noise);
 }
 
 for (int fil = 0; fil < 3; ++fil) {
 	//fil top listener
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_vel", &m_tree_listener_fil_top);
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_env", &m_tree_listener_fil_top);
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_kbd", &m_tree_listener_fil_top);
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_gain", &m_tree_listener_fil_top);
+	listenToParameter("fil" + std::to_string(fil + 1) + "_vel", m_tree_listener_fil_top);
+	listenToParameter("fil" + std::to_string(fil + 1) + "_env", m_tree_listener_fil_top);
+	listenToParameter("fil" + std::to_string(fil + 1) + "_kbd", m_tree_listener_fil_top);
+	listenToParameter("fil" + std::to_string(fil + 1) + "_gain", m_tree_listener_fil_top);
 
 	//fil center listener
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_freq", &m_tree_listener_fil_center);
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_res", &m_tree_listener_fil_center);
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_saturation", &m_tree_listener_fil_center);
+	listenToParameter("fil" + std::to_string(fil + 1) + "_freq", m_tree_listener_fil_center);
+	listenToParameter("fil" + std::to_string(fil + 1) + "_res", m_tree_listener_fil_center);
+	listenToParameter("fil" + std::to_string(fil + 1) + "_saturation", m_tree_listener_fil_center);
 
 	//fil misc listener
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_ring_mod_amount", &m_tree_listener_fil_misc);
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_sem_transition", &m_tree_listener_fil_misc);
-	//m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_comb_polarity", &m_tree_listener_fil_misc);
+	listenToParameter("fil" + std::to_string(fil + 1) + "_ring_mod_amount", m_tree_listener_fil_misc);
+	listenToParameter("fil" + std::to_string(fil + 1) + "_sem_transition", m_tree_listener_fil_misc);
+	//listenToParameter("fil" + std::to_string(fil + 1) + "_comb_polarity", m_tree_listener_fil_misc);
 
 	//fil formant listener
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_formant_transition",
-	                                  &m_tree_listener_fil_formant);
-	//m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_vowel_left", &m_tree_listener_fil_formant);
-	//m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_vowel_right", &m_tree_listener_fil_formant);
+	listenToParameter("fil" + std::to_string(fil + 1) + "_formant_transition", m_tree_listener_fil_formant);
+	//listenToParameter("fil" + std::to_string(fil + 1) + "_vowel_left", m_tree_listener_fil_formant);
+	//listenToParameter("fil" + std::to_string(fil + 1) + "_vowel_right", m_tree_listener_fil_formant);
 }
 
 //amp listener
-m_value_tree.addParameterListener("amp_pan", &m_tree_listener_amp);
-m_value_tree.addParameterListener("amp_gain", &m_tree_listener_amp);
-m_value_tree.addParameterListener("amp_velocity", &m_tree_listener_amp);
-m_value_tree.addParameterListener("dist_boost", &m_tree_listener_amp);
-m_value_tree.addParameterListener("dist_drywet", &m_tree_listener_amp);
+listenToParameter("amp_pan", m_tree_listener_amp);
+listenToParameter("amp_gain", m_tree_listener_amp);
+listenToParameter("amp_velocity", m_tree_listener_amp);
+listenToParameter("dist_boost", m_tree_listener_amp);
+listenToParameter("dist_drywet", m_tree_listener_amp);
 
 //delay listener
-m_value_tree.addParameterListener("delay_time", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_feedback", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_hp", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_ducking", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_dry", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_wet", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_pingpong", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_on", &m_tree_listener_delay);
+listenToParameter("delay_time", m_tree_listener_delay);
+listenToParameter("delay_feedback", m_tree_listener_delay);
+listenToParameter("delay_hp", m_tree_listener_delay);
+listenToParameter("delay_ducking", m_tree_listener_delay);
+listenToParameter("delay_dry", m_tree_listener_delay);
+listenToParameter("delay_wet", m_tree_listener_delay);
+listenToParameter("delay_pingpong", m_tree_listener_delay);
+listenToParameter("delay_on", m_tree_listener_delay);
 
 //reverb listener
-m_value_tree.addParameterListener("rev_eqfreq", &m_tree_listener_reverb);
-m_value_tree.addParameterListener("rev_eqgain", &m_tree_listener_reverb);
-//m_value_tree.addParameterListener("rev_ducking", &m_tree_listener_reverb);
-m_value_tree.addParameterListener("rev_drywet", &m_tree_listener_reverb);
-m_value_tree.addParameterListener("rev_delay", &m_tree_listener_reverb);
-m_value_tree.addParameterListener("reverb_on", &m_tree_listener_reverb);
-m_value_tree.addParameterListener("rev_mid_hall", &m_tree_listener_reverb);
-m_value_tree.addParameterListener("rev_hf_damp", &m_tree_listener_reverb);
+listenToParameter("rev_eqfreq", m_tree_listener_reverb);
+listenToParameter("rev_eqgain", m_tree_listener_reverb);
+//listenToParameter("rev_ducking", m_tree_listener_reverb);
+listenToParameter("rev_drywet", m_tree_listener_reverb);
+listenToParameter("rev_delay", m_tree_listener_reverb);
+listenToParameter("reverb_on", m_tree_listener_reverb);
+listenToParameter("rev_mid_hall", m_tree_listener_reverb);
+listenToParameter("rev_hf_damp", m_tree_listener_reverb);
 
 //chorus listener
-m_value_tree.addParameterListener("chorus_rate", &m_tree_listener_chorus);
-m_value_tree.addParameterListener("chorus_amount", &m_tree_listener_chorus);
-m_value_tree.addParameterListener("chorus_drywet", &m_tree_listener_chorus);
-m_value_tree.addParameterListener("chorus_feedback", &m_tree_listener_chorus);
-m_value_tree.addParameterListener("chorus_reset", &m_tree_listener_chorus);
-m_value_tree.addParameterListener("chorus_on", &m_tree_listener_chorus);
+listenToParameter("chorus_rate", m_tree_listener_chorus);
+listenToParameter("chorus_amount", m_tree_listener_chorus);
+listenToParameter("chorus_drywet", m_tree_listener_chorus);
+listenToParameter("chorus_feedback", m_tree_listener_chorus);
+listenToParameter("chorus_reset", m_tree_listener_chorus);
+listenToParameter("chorus_on", m_tree_listener_chorus);
 
 //phaser listener
-m_value_tree.addParameterListener("phaser_rate", &m_tree_listener_phaser);
-m_value_tree.addParameterListener("phaser_freq", &m_tree_listener_phaser);
-m_value_tree.addParameterListener("phaser_feedback", &m_tree_listener_phaser);
-m_value_tree.addParameterListener("phaser_mod", &m_tree_listener_phaser);
-m_value_tree.addParameterListener("phaser_drywet", &m_tree_listener_phaser);
-m_value_tree.addParameterListener("phaser_reset", &m_tree_listener_phaser);
-m_value_tree.addParameterListener("phaser_on", &m_tree_listener_phaser);
+listenToParameter("phaser_rate", m_tree_listener_phaser);
+listenToParameter("phaser_freq", m_tree_listener_phaser);
+listenToParameter("phaser_feedback", m_tree_listener_phaser);
+listenToParameter("phaser_mod", m_tree_listener_phaser);
+listenToParameter("phaser_drywet", m_tree_listener_phaser);
+listenToParameter("phaser_reset", m_tree_listener_phaser);
+listenToParameter("phaser_on", m_tree_listener_phaser);
 
 //flanger listener
-m_value_tree.addParameterListener("flanger_rate", &m_tree_listener_flanger);
-m_value_tree.addParameterListener("flanger_amount", &m_tree_listener_flanger);
-m_value_tree.addParameterListener("flanger_drywet", &m_tree_listener_flanger);
-m_value_tree.addParameterListener("flanger_feedback", &m_tree_listener_flanger);
-m_value_tree.addParameterListener("flanger_reset", &m_tree_listener_flanger);
-m_value_tree.addParameterListener("flanger_on", &m_tree_listener_flanger);
+listenToParameter("flanger_rate", m_tree_listener_flanger);
+listenToParameter("flanger_amount", m_tree_listener_flanger);
+listenToParameter("flanger_drywet", m_tree_listener_flanger);
+listenToParameter("flanger_feedback", m_tree_listener_flanger);
+listenToParameter("flanger_reset", m_tree_listener_flanger);
+listenToParameter("flanger_on", m_tree_listener_flanger);
 
 //adsr1 listener
-m_value_tree.addParameterListener("env1_attack", &m_tree_listener_adsr1);
-m_value_tree.addParameterListener("env1_decay", &m_tree_listener_adsr1);
-m_value_tree.addParameterListener("env1_sustain", &m_tree_listener_adsr1);
-m_value_tree.addParameterListener("env1_release", &m_tree_listener_adsr1);
-m_value_tree.addParameterListener("env1_loop", &m_tree_listener_adsr1);
+listenToParameter("env1_attack", m_tree_listener_adsr1);
+listenToParameter("env1_decay", m_tree_listener_adsr1);
+listenToParameter("env1_sustain", m_tree_listener_adsr1);
+listenToParameter("env1_release", m_tree_listener_adsr1);
+listenToParameter("env1_loop", m_tree_listener_adsr1);
 
 //adsr2 listener
-m_value_tree.addParameterListener("env2_attack", &m_tree_listener_adsr2);
-m_value_tree.addParameterListener("env2_decay", &m_tree_listener_adsr2);
-m_value_tree.addParameterListener("env2_sustain", &m_tree_listener_adsr2);
-m_value_tree.addParameterListener("env2_release", &m_tree_listener_adsr2);
-m_value_tree.addParameterListener("env2_loop", &m_tree_listener_adsr2);
+listenToParameter("env2_attack", m_tree_listener_adsr2);
+listenToParameter("env2_decay", m_tree_listener_adsr2);
+listenToParameter("env2_sustain", m_tree_listener_adsr2);
+listenToParameter("env2_release", m_tree_listener_adsr2);
+listenToParameter("env2_loop", m_tree_listener_adsr2);
 
 //adsr3 listener
-m_value_tree.addParameterListener("env3_attack", &m_tree_listener_adsr3);
-m_value_tree.addParameterListener("env3_decay", &m_tree_listener_adsr3);
-m_value_tree.addParameterListener("env3_sustain", &m_tree_listener_adsr3);
-m_value_tree.addParameterListener("env3_release", &m_tree_listener_adsr3);
-m_value_tree.addParameterListener("env3_loop", &m_tree_listener_adsr3);
+listenToParameter("env3_attack", m_tree_listener_adsr3);
+listenToParameter("env3_decay", m_tree_listener_adsr3);
+listenToParameter("env3_sustain", m_tree_listener_adsr3);
+listenToParameter("env3_release", m_tree_listener_adsr3);
+listenToParameter("env3_loop", m_tree_listener_adsr3);
 
 //adsr4 listener
-m_value_tree.addParameterListener("env4_attack", &m_tree_listener_adsr4);
-m_value_tree.addParameterListener("env4_decay", &m_tree_listener_adsr4);
-m_value_tree.addParameterListener("env4_sustain", &m_tree_listener_adsr4);
-m_value_tree.addParameterListener("env4_release", &m_tree_listener_adsr4);
-m_value_tree.addParameterListener("env4_loop", &m_tree_listener_adsr4);
+listenToParameter("env4_attack", m_tree_listener_adsr4);
+listenToParameter("env4_decay", m_tree_listener_adsr4);
+listenToParameter("env4_sustain", m_tree_listener_adsr4);
+listenToParameter("env4_release", m_tree_listener_adsr4);
+listenToParameter("env4_loop", m_tree_listener_adsr4);
 
 //lfo1 listener
-m_value_tree.addParameterListener("lfo1_freq", &m_tree_listener_lfo1);
-m_value_tree.addParameterListener("lfo1_reset", &m_tree_listener_lfo1);
+listenToParameter("lfo1_freq", m_tree_listener_lfo1);
+listenToParameter("lfo1_reset", m_tree_listener_lfo1);
 
 //lfo2 listener
-m_value_tree.addParameterListener("lfo2_freq", &m_tree_listener_lfo2);
-m_value_tree.addParameterListener("lfo2_reset", &m_tree_listener_lfo2);
+listenToParameter("lfo2_freq", m_tree_listener_lfo2);
+listenToParameter("lfo2_reset", m_tree_listener_lfo2);
 
 //lfo3 listener
-m_value_tree.addParameterListener("lfo3_freq", &m_tree_listener_lfo3);
-m_value_tree.addParameterListener("lfo3_reset", &m_tree_listener_lfo3);
+listenToParameter("lfo3_freq", m_tree_listener_lfo3);
+listenToParameter("lfo3_reset", m_tree_listener_lfo3);
 
 //lfo4 listener
-m_value_tree.addParameterListener("lfo4_freq", &m_tree_listener_lfo4);
-m_value_tree.addParameterListener("lfo4_reset", &m_tree_listener_lfo4);
+listenToParameter("lfo4_freq", m_tree_listener_lfo4);
+listenToParameter("lfo4_reset", m_tree_listener_lfo4);
 
 //general misc
-m_value_tree.addParameterListener("glide", &m_tree_listener_general_misc);
-m_value_tree.addParameterListener("master", &m_tree_listener_general_misc);
+listenToParameter("glide", m_tree_listener_general_misc);
+listenToParameter("master", m_tree_listener_general_misc);
 
-m_value_tree.addParameterListener("unison_detune", &m_tree_listener_general_misc);
-m_value_tree.addParameterListener("unison_width", &m_tree_listener_general_misc);
+listenToParameter("unison_detune", m_tree_listener_general_misc);
+listenToParameter("unison_width", m_tree_listener_general_misc);
 
 //arp listener
-m_value_tree.addParameterListener("step_0_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_1_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_2_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_3_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_4_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_5_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_6_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_7_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_8_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_9_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_10_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_11_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_12_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_13_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_14_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_15_on", &m_tree_listener_arp);
-
-m_value_tree.addParameterListener("step_0_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_1_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_2_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_3_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_4_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_5_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_6_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_7_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_8_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_9_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_10_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_11_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_12_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_13_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_14_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_15_mod_1", &m_tree_listener_arp);
-
-m_value_tree.addParameterListener("step_0_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_1_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_2_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_3_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_4_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_5_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_6_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_7_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_8_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_9_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_10_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_11_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_12_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_13_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_14_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_15_mod_2", &m_tree_listener_arp);
-
-m_value_tree.addParameterListener("step_0_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_1_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_2_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_3_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_4_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_5_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_6_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_7_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_8_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_9_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_10_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_11_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_12_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_13_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_14_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_15_transpose", &m_tree_listener_arp);
-
-m_value_tree.addParameterListener("arp_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("arp_one_shot", &m_tree_listener_arp);
\ No newline at end of file
+listenToParameter("step_0_on", m_tree_listener_arp);
+listenToParameter("step_1_on", m_tree_listener_arp);
+listenToParameter("step_2_on", m_tree_listener_arp);
+listenToParameter("step_3_on", m_tree_listener_arp);
+listenToParameter("step_4_on", m_tree_listener_arp);
+listenToParameter("step_5_on", m_tree_listener_arp);
+listenToParameter("step_6_on", m_tree_listener_arp);
+listenToParameter("step_7_on", m_tree_listener_arp);
+listenToParameter("step_8_on", m_tree_listener_arp);
+listenToParameter("step_9_on", m_tree_listener_arp);
+listenToParameter("step_10_on", m_tree_listener_arp);
+listenToParameter("step_11_on", m_tree_listener_arp);
+listenToParameter("step_12_on", m_tree_listener_arp);
+listenToParameter("step_13_on", m_tree_listener_arp);
+listenToParameter("step_14_on", m_tree_listener_arp);
+listenToParameter("step_15_on", m_tree_listener_arp);
+
+listenToParameter("step_0_mod_1", m_tree_listener_arp);
+listenToParameter("step_1_mod_1", m_tree_listener_arp);
+listenToParameter("step_2_mod_1", m_tree_listener_arp);
+listenToParameter("step_3_mod_1", m_tree_listener_arp);
+listenToParameter("step_4_mod_1", m_tree_listener_arp);
+listenToParameter("step_5_mod_1", m_tree_listener_arp);
+listenToParameter("step_6_mod_1", m_tree_listener_arp);
+listenToParameter("step_7_mod_1", m_tree_listener_arp);
+listenToParameter("step_8_mod_1", m_tree_listener_arp);
+listenToParameter("step_9_mod_1", m_tree_listener_arp);
+listenToParameter("step_10_mod_1", m_tree_listener_arp);
+listenToParameter("step_11_mod_1", m_tree_listener_arp);
+listenToParameter("step_12_mod_1", m_tree_listener_arp);
+listenToParameter("step_13_mod_1", m_tree_listener_arp);
+listenToParameter("step_14_mod_1", m_tree_listener_arp);
+listenToParameter("step_15_mod_1", m_tree_listener_arp);
+
+listenToParameter("step_0_mod_2", m_tree_listener_arp);
+listenToParameter("step_1_mod_2", m_tree_listener_arp);
+listenToParameter("step_2_mod_2", m_tree_listener_arp);
+listenToParameter("step_3_mod_2", m_tree_listener_arp);
+listenToParameter("step_4_mod_2", m_tree_listener_arp);
+listenToParameter("step_5_mod_2", m_tree_listener_arp);
+listenToParameter("step_6_mod_2", m_tree_listener_arp);
+listenToParameter("step_7_mod_2", m_tree_listener_arp);
+listenToParameter("step_8_mod_2", m_tree_listener_arp);
+listenToParameter("step_9_mod_2", m_tree_listener_arp);
+listenToParameter("step_10_mod_2", m_tree_listener_arp);
+listenToParameter("step_11_mod_2", m_tree_listener_arp);
+listenToParameter("step_12_mod_2", m_tree_listener_arp);
+listenToParameter("step_13_mod_2", m_tree_listener_arp);
+listenToParameter("step_14_mod_2", m_tree_listener_arp);
+listenToParameter("step_15_mod_2", m_tree_listener_arp);
+
+listenToParameter("step_0_transpose", m_tree_listener_arp);
+listenToParameter("step_1_transpose", m_tree_listener_arp);
+listenToParameter("step_2_transpose", m_tree_listener_arp);
+listenToParameter("step_3_transpose", m_tree_listener_arp);
+listenToParameter("step_4_transpose", m_tree_listener_arp);
+listenToParameter("step_5_transpose", m_tree_listener_arp);
+listenToParameter("step_6_transpose", m_tree_listener_arp);
+listenToParameter("step_7_transpose", m_tree_listener_arp);
+listenToParameter("step_8_transpose", m_tree_listener_arp);
+listenToParameter("step_9_transpose", m_tree_listener_arp);
+listenToParameter("step_10_transpose", m_tree_listener_arp);
+listenToParameter("step_11_transpose", m_tree_listener_arp);
+listenToParameter("step_12_transpose", m_tree_listener_arp);
+listenToParameter("step_13_transpose", m_tree_listener_arp);
+listenToParameter("step_14_transpose", m_tree_listener_arp);
+listenToParameter("step_15_transpose", m_tree_listener_arp);
+
+listenToParameter("arp_on", m_tree_listener_arp);
+listenToParameter("arp_one_shot", m_tree_listener_arp);
\ No newline at end of file
@@ -342,6 +342,7 @@
     Identifier m_dist_drywet_identifier;
     Identifier m_dist_on_identifier;
     Identifier m_dist_algo_identifier;
+    Identifier m_voice_oversampling_identifier;
     Identifier m_fil1_to_amp_identifier;
     Identifier m_fil2_to_amp_identifier;
     Identifier m_env1_attack_identifier;
@@ -598,4 +599,5 @@
     Identifier m_scale_row_8_identifier;
     Identifier m_scale_row_9_identifier;
     Identifier m_BPM_identifier;
+    Identifier m_unison_voices_identifier;
     //Identifier m_pitchbend_amount_identifier;
\ No newline at end of file
@@ -52,6 +52,14 @@ void ConfigFileManager::loadDataFromFile() {
 						m_spline_ad_1_seen = child->getBoolAttribute("data");
 					} else if (child->hasTagName(XML_ATTRIBUTE_SPLINE_AD2)) {
 						m_spline_ad_2_seen = child->getBoolAttribute("data");
+					} else if (child->hasTagName(XML_ATTRIBUTE_MULTICORE_VOICES)) {
+						m_multicore_voices = child->getBoolAttribute("data");
+					} else if (child->hasTagName(XML_ATTRIBUTE_POLYPHONY)) {
+						m_polyphony = child->getIntAttribute("data");
+					} else if (child->hasTagName(XML_ATTRIBUTE_CONTROL_RATE)) {
+						m_control_rate = child->getIntAttribute("data");
+					} else if (child->hasTagName(XML_ATTRIBUTE_REVERB_HALF_RATE)) {
+						m_reverb_half_rate = child->getBoolAttribute("data");
 					} else if (child->hasTagName(XML_ATTRIBUTE_SHOW_TOOLTIP)) {
 						m_show_tooltip = child->getBoolAttribute("data");
 					} else if (child->hasTagName(XML_ATTRIBUTE_TUNING_DIR)) {
@@ -90,6 +98,22 @@ void ConfigFileManager::saveDataToFile() {
 	spline_ad2->setAttribute("data", m_spline_ad_2_seen);
 	config_xml->addChildElement(spline_ad2);
 
+	XmlElement *multicore_voices = new XmlElement(XML_ATTRIBUTE_MULTICORE_VOICES);
+	multicore_voices->setAttribute("data", m_multicore_voices);
+	config_xml->addChildElement(multicore_voices);
+
+	XmlElement *polyphony = new XmlElement(XML_ATTRIBUTE_POLYPHONY);
+	polyphony->setAttribute("data", m_polyphony);
+	config_xml->addChildElement(polyphony);
+
+	XmlElement *control_rate = new XmlElement(XML_ATTRIBUTE_CONTROL_RATE);
+	control_rate->setAttribute("data", m_control_rate);
+	config_xml->addChildElement(control_rate);
+
+	XmlElement *reverb_half_rate = new XmlElement(XML_ATTRIBUTE_REVERB_HALF_RATE);
+	reverb_half_rate->setAttribute("data", m_reverb_half_rate);
+	config_xml->addChildElement(reverb_half_rate);
+
 	XmlElement *show_tooltip = new XmlElement(XML_ATTRIBUTE_SHOW_TOOLTIP);
 	show_tooltip->setAttribute("data", m_show_tooltip);
 	config_xml->addChildElement(show_tooltip);
@@ -158,6 +182,38 @@ bool ConfigFileManager::getOptionSplineAd2Seen() {
 	return m_spline_ad_2_seen;
 }
 
+void ConfigFileManager::setOptionMultiCoreVoices(bool p_enabled) {
+	m_multicore_voices = p_enabled;
+}
+
+bool ConfigFileManager::getOptionMultiCoreVoices() {
+	return m_multicore_voices;
+}
+
+void ConfigFileManager::setOptionPolyphony(int p_voices) {
+	m_polyphony = p_voices;
+}
+
+int ConfigFileManager::getOptionPolyphony() {
+	return m_polyphony;
+}
+
+void ConfigFileManager::setOptionControlRate(int p_samples) {
+	m_control_rate = p_samples;
+}
+
+int ConfigFileManager::getOptionControlRate() {
+	return m_control_rate;
+}
+
+void ConfigFileManager::setOptionReverbHalfRate(bool p_enabled) {
+	m_reverb_half_rate = p_enabled;
+}
+
+bool ConfigFileManager::getOptionReverbHalfRate() {
+	return m_reverb_half_rate;
+}
+
 void ConfigFileManager::setOptionGuiScale(int p_scale) {
 	m_gui_scale = p_scale;
 }
@@ -31,6 +31,10 @@
 #define XML_ATTRIBUTE_GUI_OPEN ("num_gui_opens")
 #define XML_ATTRIBUTE_SPLINE_AD1 ("spline_ad1_seen")
 #define XML_ATTRIBUTE_SPLINE_AD2 ("spline_ad2_seen")
+#define XML_ATTRIBUTE_MULTICORE_VOICES ("multicore_voices")
+#define XML_ATTRIBUTE_POLYPHONY ("polyphony")
+#define XML_ATTRIBUTE_CONTROL_RATE ("control_rate")
+#define XML_ATTRIBUTE_REVERB_HALF_RATE ("reverb_half_rate")
 
 /**
  * This class manages the config file. Data is loaded from the file in constructor if possible. Then the individual 
@@ -65,6 +69,14 @@ public:
 	bool getOptionSplineAd1Seen();
 	void setOptionSplineAd2Seen(bool p_seen);
 	bool getOptionSplineAd2Seen();
+	void setOptionMultiCoreVoices(bool p_enabled);
+	bool getOptionMultiCoreVoices();
+	void setOptionPolyphony(int p_voices);
+	int getOptionPolyphony();
+	void setOptionControlRate(int p_samples);
+	int getOptionControlRate();
+	void setOptionReverbHalfRate(bool p_enabled);
+	bool getOptionReverbHalfRate();
 
 private:
 	ConfigFileManager();
@@ -77,6 +89,10 @@ private:
 	bool m_show_tooltip     = false;
 	bool m_spline_ad_1_seen = false;
 	bool m_spline_ad_2_seen = false;
+	bool m_multicore_voices = false;
+	int m_polyphony         = VOICES_DEFAULT;
+	int m_control_rate      = CONTROL_RATE_DEFAULT;
+	bool m_reverb_half_rate = false;
 
 	String m_tuning_dir     = DEFAULT_TUNING_DIRECTORY;
 	String m_soundbank_dir  = DEFAULT_SOUNDBANK_IO_LOCATION_STRING;
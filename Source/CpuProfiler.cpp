@@ -0,0 +1,191 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "CpuProfiler.h"
+
+#include <cstring>
+
+#define PROFILER_CALIBRATION_LAPS 1000
+
+CpuProfiler::CpuProfiler() {
+	for (int section = 0; section < NUM_SECTIONS; ++section) {
+		m_load[section].store(0.f);
+	}
+
+	// the shortest of many back to back laps is what the clock read itself costs
+	m_running       = true;
+	uint64 overhead = ~(uint64)0;
+	for (int lap_index = 0; lap_index < PROFILER_CALIBRATION_LAPS; ++lap_index) {
+		start(0);
+		const uint64 before = m_lanes[0].ticks[0];
+		lap(0, 0);
+		overhead = jmin(overhead, m_lanes[0].ticks[0] - before);
+	}
+	m_lap_overhead = overhead;
+	m_running      = false;
+	reset();
+}
+
+const char *CpuProfiler::getSectionName(int p_section) {
+	static const char *names[NUM_SECTIONS] = {"Parameter Changes",
+	                                          "MIDI & Arpeggiator",
+	                                          "Smoothing",
+	                                          "Mod Matrix",
+	                                          "Envelopes & LFOs",
+	                                          "Analog Osc",
+	                                          "Wavetable Osc",
+	                                          "Multi Osc",
+	                                          "Vector Osc",
+	                                          "Chiptune Osc",
+	                                          "FM Osc",
+	                                          "PM Osc",
+	                                          "Noise Osc",
+	                                          "Wavedraw Osc",
+	                                          "Chipdraw Osc",
+	                                          "Specdraw Osc",
+	                                          "Ladder Filter",
+	                                          "SEM Filter",
+	                                          "Korg Filter",
+	                                          "Diode Filter",
+	                                          "Formant Filter",
+	                                          "Comb Filter",
+	                                          "Ring Modulator",
+	                                          "Amp & Distortion",
+	                                          "Voice Oversampling",
+	                                          "Filter 3",
+	                                          "Delay",
+	                                          "Phaser",
+	                                          "Flanger",
+	                                          "Chorus",
+	                                          "Reverb",
+	                                          "Output"};
+	return names[p_section];
+}
+
+int CpuProfiler::getOscSection(int p_osc_type) {
+	switch (p_osc_type) {
+	case OSC_TYPE_ANALOG:
+		return OscAnalog;
+	case OSC_TYPE_WAVETABLE:
+		return OscWavetable;
+	case OSC_TYPE_MULTI:
+		return OscMulti;
+	case OSC_TYPE_VECTOR:
+		return OscVector;
+	case OSC_TYPE_CHIPTUNE:
+		return OscChiptune;
+	case OSC_TYPE_FM:
+		return OscFM;
+	case OSC_TYPE_PM:
+		return OscPM;
+	case OSC_TYPE_NOISE:
+		return OscNoise;
+	case OSC_TYPE_WAVEDRAW:
+		return OscWavedraw;
+	case OSC_TYPE_CHIPDRAW:
+		return OscChipdraw;
+	case OSC_TYPE_SPECDRAW:
+		return OscSpecdraw;
+	default:
+		return -1;
+	}
+}
+
+int CpuProfiler::getFilterSection(int p_filter_type) {
+	switch (p_filter_type) {
+	case FILTER_TYPE_LP24:
+	case FILTER_TYPE_LP12:
+	case FILTER_TYPE_BP24:
+	case FILTER_TYPE_BP12:
+	case FILTER_TYPE_HP24:
+	case FILTER_TYPE_HP12:
+		return FilterLadder;
+	case FILTER_TYPE_SEM12:
+		return FilterSEM;
+	case FILTER_TYPE_KORG_LP:
+	case FILTER_TYPE_KORG_HP:
+		return FilterKorg;
+	case FILTER_TYPE_DIODE:
+		return FilterDiode;
+	case FILTER_TYPE_FORMANT:
+		return FilterFormant;
+	case FILTER_TYPE_COMB:
+		return FilterComb;
+	case FILTER_TYPE_RINGMOD:
+		return FilterRingMod;
+	default:
+		return -1;
+	}
+}
+
+void CpuProfiler::beginBlock() {
+	const bool enabled = m_enabled.load(std::memory_order_relaxed);
+	if (enabled && !m_running) {
+		// counts from before the profiler was switched off would be published with the first period
+		reset();
+	}
+	m_running = enabled;
+	if (!m_running) {
+		return;
+	}
+
+	m_block_start_os                 = Time::getHighResolutionTicks();
+	m_block_start                    = readTicks();
+	m_lanes[PROFILER_MONO_LANE].last = m_block_start;
+}
+
+void CpuProfiler::endBlock(int p_num_samples) {
+	if (!m_running) {
+		return;
+	}
+
+	m_block_ticks += readTicks() - m_block_start;
+	m_block_ticks_os += Time::getHighResolutionTicks() - m_block_start_os;
+	m_block_samples += p_num_samples;
+
+	if (m_block_samples >= (int64)(m_samplerate * PROFILER_PUBLISH_SECONDS)) {
+		publish();
+		reset();
+	}
+}
+
+void CpuProfiler::reset() {
+	for (int lane = 0; lane < PROFILER_LANES; ++lane) {
+		memset(m_lanes[lane].ticks, 0, sizeof(m_lanes[lane].ticks));
+	}
+	m_block_samples  = 0;
+	m_block_ticks    = 0;
+	m_block_ticks_os = 0;
+}
+
+void CpuProfiler::publish() {
+	if (m_block_ticks == 0 || m_block_ticks_os <= 0) {
+		return;
+	}
+
+	// profiler ticks per second, measured over the same blocks the sections were timed in
+	const double ticks_per_second =
+	    (double)m_block_ticks * (double)Time::getHighResolutionTicksPerSecond() / (double)m_block_ticks_os;
+	const double budget_ticks = ticks_per_second * (double)m_block_samples / m_samplerate;
+
+	for (int section = 0; section < NUM_SECTIONS; ++section) {
+		uint64 ticks = 0;
+		for (int lane = 0; lane < PROFILER_LANES; ++lane) {
+			ticks += m_lanes[lane].ticks[section];
+		}
+		m_load[section].store((float)(100. * (double)ticks / budget_ticks), std::memory_order_relaxed);
+	}
+	m_total_load.store((float)(100. * (double)m_block_ticks / budget_ticks), std::memory_order_relaxed);
+}
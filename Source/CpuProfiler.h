@@ -0,0 +1,169 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "GlobalIncludes.h"
+
+#include <atomic>
+
+#if JUCE_INTEL
+#if JUCE_MSVC
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+// the loads are averaged over this much audio before they are handed to the gui
+#define PROFILER_PUBLISH_SECONDS 0.25
+// one lane per voice and one for the audio thread, which does everything that is not per voice
+#define PROFILER_MONO_LANE VOICES
+#define PROFILER_LANES (VOICES + 1)
+
+/**
+ * Measures how much of the real-time budget each stage of processBlock() takes, switched on from the editor.
+ * Instead of nested scoped timers every stage ends with lap(), which books the time since the previous lap of the
+ * same lane to a section. So one clock read ends a stage and starts the next one. Voices get a lane each, so voices
+ * rendered on helper threads never write to the same counters. The audio thread sums the lanes once a publish period
+ * is full and hands the loads to the gui through atomics.
+ * The loads are in percent of one core's budget, voices spread across several cores can add up to more than the
+ * total, which is the wall clock time of processBlock(). While the profiler is off a lap costs a single branch.
+ */
+class CpuProfiler {
+public:
+	enum Section {
+		Parameters,
+		MidiArp,
+		Smoothing,
+		ModMatrix,
+		Modulators,
+		OscAnalog,
+		OscWavetable,
+		OscMulti,
+		OscVector,
+		OscChiptune,
+		OscFM,
+		OscPM,
+		OscNoise,
+		OscWavedraw,
+		OscChipdraw,
+		OscSpecdraw,
+		FilterLadder,
+		FilterSEM,
+		FilterKorg,
+		FilterDiode,
+		FilterFormant,
+		FilterComb,
+		FilterRingMod,
+		AmpDistortion,
+		Oversampling,
+		Filter3,
+		Delay,
+		Phaser,
+		Flanger,
+		Chorus,
+		Reverb,
+		Output,
+		NUM_SECTIONS
+	};
+
+	CpuProfiler();
+
+	static const char *getSectionName(int p_section);
+	// map OSC_TYPE_* and FILTER_TYPE_* to their section, -1 for types without one
+	static int getOscSection(int p_osc_type);
+	static int getFilterSection(int p_filter_type);
+
+	// can be called from any thread, the audio thread picks it up at the start of the next block
+	void setEnabled(bool p_enabled) {
+		m_enabled.store(p_enabled, std::memory_order_relaxed);
+	}
+	bool isEnabled() const {
+		return m_enabled.load(std::memory_order_relaxed);
+	}
+
+	// audio thread only
+	void setSampleRate(double p_samplerate) {
+		m_samplerate = p_samplerate;
+	}
+	void beginBlock();
+	void endBlock(int p_num_samples);
+
+	// restarts the clock of a lane without booking the time since its last lap
+	inline void start(int p_lane) {
+		if (m_running) {
+			m_lanes[p_lane].last = readTicks();
+		}
+	}
+
+	// books the time since the last lap or start of p_lane to p_section, a negative section drops it
+	inline void lap(int p_lane, int p_section) {
+		if (m_running) {
+			const uint64 now = readTicks();
+			Lane &lane       = m_lanes[p_lane];
+			if (p_section >= 0) {
+				const uint64 elapsed = now - lane.last;
+				lane.ticks[p_section] += elapsed > m_lap_overhead ? elapsed - m_lap_overhead : 0;
+			}
+			lane.last = now;
+		}
+	}
+
+	// load of a section and of the whole block in percent of the real-time budget, can be called from any thread
+	float getLoad(int p_section) const {
+		return m_load[p_section].load(std::memory_order_relaxed);
+	}
+	float getTotalLoad() const {
+		return m_total_load.load(std::memory_order_relaxed);
+	}
+
+private:
+	static inline uint64 readTicks() {
+#if JUCE_INTEL
+		// a fraction of the cost of the os clock, which adds up with a few laps per voice and sample
+		return __rdtsc();
+#else
+		return (uint64)Time::getHighResolutionTicks();
+#endif
+	}
+
+	void reset();
+	void publish();
+
+	// a cache line each, so voices rendered on different threads don't share one
+	struct alignas(64) Lane {
+		uint64 last                = 0;
+		uint64 ticks[NUM_SECTIONS] = {0};
+	};
+	Lane m_lanes[PROFILER_LANES];
+
+	std::atomic<bool> m_enabled{false};
+	bool m_running = false;
+	// cost of a lap itself, taken off every lap so sections with many short laps are not inflated
+	uint64 m_lap_overhead = 0;
+
+	double m_samplerate   = 44100.;
+	int64 m_block_samples = 0;
+	// the block is timed with both clocks, so the profiler clock can be converted to seconds
+	uint64 m_block_start   = 0;
+	int64 m_block_start_os = 0;
+	uint64 m_block_ticks   = 0;
+	int64 m_block_ticks_os = 0;
+
+	std::atomic<float> m_load[NUM_SECTIONS];
+	std::atomic<float> m_total_load{0.f};
+};
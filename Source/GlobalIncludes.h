@@ -64,7 +64,23 @@
 #define WAVETABLE_DROPDOWN_COLOR juce::Colour(66, 81, 85)
 #define DARKGREY juce::Colour(30, 30, 30)
 #define CHORUS_DISPLAY_COLOR Colour(69, 39, 38)
-#define VOICES 24
+// the highest polyphony, only as many voices as the polyphony set at runtime (VOICES_MIN ... VOICES) are allocated
+#define VOICES 64
+#define VOICES_MIN 8
+#define VOICES_DEFAULT 24
+// unison voices per note, the pan and detune distributions exist for 1, 2, 3, 4, 6 and 12 voices
+#define UNISON_VOICES_MAX 12
+// held down notes remembered in mono and legato mode
+#define MONO_NOTE_LIST_SIZE 128
+// processBlock renders in sub-blocks of at most this many samples, they are additionally split at midi events
+#define SUB_BLOCK_SIZE_MAX 32
+// the voices of a patch can run at 1x, 2x or 4x the host rate, their sum is decimated before filter 3
+#define VOICE_OVERSAMPLING_MAX 4
+// the mod matrix runs every CONTROL_RATE samples (1 to CONTROL_RATE_MAX), destinations are ramped in between
+#define CONTROL_RATE_DEFAULT 1
+#define CONTROL_RATE_MAX 32
+// tail allowance for filter 3 when it is not a comb filter, the fx report their own tails
+#define FILTER3_TAIL_SECONDS 0.2f
 
 #define MATRIX_SECTION_INDEX_PRESETS 10
 #define MATRIX_SECTION_INDEX_ARP 1
@@ -18,13 +18,31 @@
 #include <functional>
 #pragma once
 
-class OdinTreeListener : public AudioProcessorValueTreeState::Listener {
+// listens to a group of parameters, the command slot of each parameter is resolved once when it is attached
+class OdinTreeListener {
 public:
-	std::function<void(const String &, float)> onValueChange;
+	std::function<void(int, float)> onValueChange;
 
-	void parameterChanged(const String &parameterID, float newValue) override {
-		onValueChange(parameterID, newValue);
+	void listenTo(AudioProcessorValueTreeState &p_tree, const String &p_ID, int p_slot) {
+		p_tree.addParameterListener(p_ID, m_slot_listeners.add(new SlotListener(*this, p_slot)));
 	}
+
+private:
+	class SlotListener : public AudioProcessorValueTreeState::Listener {
+	public:
+		SlotListener(OdinTreeListener &p_owner, int p_slot) : m_owner(p_owner), m_slot(p_slot) {
+		}
+
+		void parameterChanged(const String &, float newValue) override {
+			m_owner.onValueChange(m_slot, newValue);
+		}
+
+	private:
+		OdinTreeListener &m_owner;
+		const int m_slot;
+	};
+
+	OwnedArray<SlotListener> m_slot_listeners;
 };
 
 class OdinTreeListenerNonParam : public ValueTree::Listener {
@@ -0,0 +1,103 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+#include <atomic>
+#include <memory>
+
+/**
+ * Hands parameter changes over to the audio thread, which applies them at the start of a block.
+ * Every parameter has a slot holding its latest value. A change writes the value and queues the slot index unless
+ * the slot is already waiting, so a slot is queued at most once: the ring can never overflow and dense automation
+ * collapses into one command per parameter and block.
+ * Changes may come from any thread (gui, host automation, state loading) and nothing locks. A producer claims a
+ * ticket with an atomic increment and publishes its slot together with the ticket in the ring entry of that ticket.
+ * The consumer stops at the first entry which does not hold the ticket it expects, i.e. one which was claimed but
+ * not published yet, and picks it up in the next drain. Only one thread may drain at a time, which is processBlock()
+ * or prepareToPlay().
+ */
+class ParameterCommandQueue {
+public:
+	// not thread safe, call before any changes are pushed
+	void setNumSlots(int p_num_slots) {
+		m_num_slots = p_num_slots;
+		m_value.reset(new std::atomic<float>[p_num_slots]);
+		m_queued.reset(new std::atomic<bool>[p_num_slots]);
+		for (int slot = 0; slot < p_num_slots; ++slot) {
+			m_value[slot].store(0.f);
+			m_queued[slot].store(false);
+		}
+
+		// at most one entry per slot is in the ring, a power of two keeps the indices valid when the counters wrap
+		int ring_size = 1;
+		while (ring_size < p_num_slots) {
+			ring_size *= 2;
+		}
+		m_ring_mask = (uint32)ring_size - 1;
+		m_ring.reset(new std::atomic<uint64>[ring_size]);
+		// the tickets start at ring_size, so no entry holds the first ticket before it is published
+		m_read = (uint32)ring_size;
+		m_write.store((uint32)ring_size);
+		for (int entry = 0; entry < ring_size; ++entry) {
+			m_ring[entry].store(packEntry(0, 0));
+		}
+	}
+
+	int getNumSlots() const {
+		return m_num_slots;
+	}
+
+	void push(int p_slot, float p_value) {
+		jassert(p_slot >= 0 && p_slot < m_num_slots);
+		m_value[p_slot].store(p_value);
+		if (!m_queued[p_slot].exchange(true)) {
+			const uint32 ticket = m_write.fetch_add(1, std::memory_order_relaxed);
+			m_ring[ticket & m_ring_mask].store(packEntry(ticket, p_slot), std::memory_order_release);
+		}
+	}
+
+	// calls p_apply(slot, value) for every slot which changed since the last call
+	template <typename Apply> void drain(Apply &&p_apply) {
+		while (true) {
+			const uint64 entry = m_ring[m_read & m_ring_mask].load(std::memory_order_acquire);
+			if ((uint32)(entry >> 32) != m_read) {
+				return;
+			}
+			const int slot = (int)(uint32)entry;
+			++m_read;
+			// the flag is cleared before the value is read, a change arriving in between is queued once more
+			m_queued[slot].store(false);
+			p_apply(slot, m_value[slot].load());
+		}
+	}
+
+private:
+	static inline uint64 packEntry(uint32 p_ticket, int p_slot) {
+		return ((uint64)p_ticket << 32) | (uint32)p_slot;
+	}
+
+	int m_num_slots = 0;
+	std::unique_ptr<std::atomic<float>[]> m_value;
+	std::unique_ptr<std::atomic<bool>[]> m_queued;
+	std::unique_ptr<std::atomic<uint64>[]> m_ring;
+	uint32 m_ring_mask = 0;
+
+	// the tickets count up forever, their ring entry is the ticket masked with m_ring_mask
+	uint32 m_read = 0;
+	std::atomic<uint32> m_write{0};
+};
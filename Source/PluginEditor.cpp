@@ -105,6 +105,7 @@ OdinEditor::OdinEditor(OdinAudioProcessor &p_processor, AudioProcessorValueTreeS
     m_processor(p_processor),
     m_patch_browser(p_processor, vts),
     m_tuning(p_processor),
+    m_cpu_profiler_overlay(p_processor.getCpuProfiler()),
     m_mono_poly_legato_dropdown(GlassDropdown::Type::dropdown_14x4),
     m_modwheel(OdinKnob::Type::wheel),
     m_glide(OdinKnob::Type::knob_6x6b) {
@@ -353,6 +354,26 @@ OdinEditor::OdinEditor(OdinAudioProcessor &p_processor, AudioProcessorValueTreeS
 			menu.addItem(1000, "Hide Tooltips");
 		else
 			menu.addItem(1000, "Show Tooltips");
+		menu.addItem(1010, "Multi-Core Voice Rendering", true, ConfigFileManager::getInstance().getOptionMultiCoreVoices());
+		menu.addItem(1020, "Show CPU Profiler", true, m_cpu_profiler_overlay.isVisible());
+		PopupMenu polyphonyMenu;
+		for (const auto voices : {8, 16, 24, 32, 48, 64}) {
+			polyphonyMenu.addItem(1200 + voices, juce::String(voices) + " Voices", true, ConfigFileManager::getInstance().getOptionPolyphony() == voices);
+		}
+		menu.addSubMenu("Polyphony", polyphonyMenu);
+		PopupMenu controlRateMenu;
+		for (const auto samples : {1, 8, 16, 32}) {
+			controlRateMenu.addItem(1300 + samples, samples == 1 ? juce::String("Every Sample") : juce::String("Every ") + juce::String(samples) + " Samples", true, ConfigFileManager::getInstance().getOptionControlRate() == samples);
+		}
+		menu.addSubMenu("Modulation Rate", controlRateMenu);
+		menu.addItem(1030, "Half-Rate Reverb (Live Only)", true, ConfigFileManager::getInstance().getOptionReverbHalfRate());
+		PopupMenu oversamplingMenu;
+		const int voice_oversampling = (int)m_value_tree.state.getChildWithName("misc")["voice_oversampling"];
+		for (const auto factor : {1, 2, VOICE_OVERSAMPLING_MAX}) {
+			// at 1x hard sync and distortion keep their own 3x oversampling, as in older versions
+			oversamplingMenu.addItem(1400 + factor, factor == 1 ? juce::String("Off (Sync and Distortion 3x)") : juce::String(factor) + "x (Whole Voice)", true, voice_oversampling == factor);
+		}
+		menu.addSubMenu("Voice Oversampling (Patch)", oversamplingMenu);
 
 		menu.addSeparator(), menu.addItem(1050, "Open Main Storage Path");
 		menu.addSeparator();
@@ -387,6 +408,48 @@ OdinEditor::OdinEditor(OdinAudioProcessor &p_processor, AudioProcessorValueTreeS
 			return;
 		}
 
+		if (ret == 1010) {
+			const auto new_multicore_state = !ConfigFileManager::getInstance().getOptionMultiCoreVoices();
+			ConfigFileManager::getInstance().setOptionMultiCoreVoices(new_multicore_state);
+			ConfigFileManager::getInstance().saveDataToFile();
+			m_processor.setMultiCoreVoiceRendering(new_multicore_state);
+			return;
+		}
+
+		if (ret == 1020) {
+			m_cpu_profiler_overlay.setVisibleAndStartTimer(!m_cpu_profiler_overlay.isVisible());
+			m_cpu_profiler_overlay.toFront(false);
+			return;
+		}
+
+		if (ret == 1030) {
+			const auto new_half_rate_state = !ConfigFileManager::getInstance().getOptionReverbHalfRate();
+			ConfigFileManager::getInstance().setOptionReverbHalfRate(new_half_rate_state);
+			ConfigFileManager::getInstance().saveDataToFile();
+			m_processor.setReverbHalfRate(new_half_rate_state);
+			return;
+		}
+
+		if (ret > 1200 && ret <= 1200 + VOICES) {
+			ConfigFileManager::getInstance().setOptionPolyphony(ret - 1200);
+			ConfigFileManager::getInstance().saveDataToFile();
+			m_processor.setPolyphony(ret - 1200);
+			return;
+		}
+
+		if (ret > 1300 && ret <= 1300 + CONTROL_RATE_MAX) {
+			ConfigFileManager::getInstance().setOptionControlRate(ret - 1300);
+			ConfigFileManager::getInstance().saveDataToFile();
+			m_processor.setControlRate(ret - 1300);
+			return;
+		}
+
+		if (ret > 1400 && ret <= 1400 + VOICE_OVERSAMPLING_MAX) {
+			// stored with the patch, the processor picks it up from the value tree
+			m_value_tree.state.getChildWithName("misc").setProperty("voice_oversampling", ret - 1400, nullptr);
+			return;
+		}
+
 		if (ret == 1050) {
 			juce::URL(ODIN_STORAGE_PATH).launchInDefaultBrowser();
 			return;
@@ -757,6 +820,8 @@ OdinEditor::OdinEditor(OdinAudioProcessor &p_processor, AudioProcessorValueTreeS
 	bool show_spline_ad = ConfigFileManager::getInstance().getNumGuiOpens() > NUM_SP_AD1 && !ConfigFileManager::getInstance().getOptionSplineAd1Seen();
 	show_spline_ad |= ConfigFileManager::getInstance().getNumGuiOpens() > NUM_SP_AD2 && !ConfigFileManager::getInstance().getOptionSplineAd2Seen();
 	m_spline_ad.setVisible(show_spline_ad);
+
+	addChildComponent(m_cpu_profiler_overlay);
 	
 	UIAssetManager::getInstance()->registerEditor(this);
 
@@ -884,6 +949,10 @@ void OdinEditor::resized() {
 
 	m_spline_ad.setBounds(getLocalBounds());
 	m_rescale_component.setBounds(getLocalBounds());
+	m_cpu_profiler_overlay.setBounds(getLocalBounds()
+	                                     .removeFromRight(proportionOfWidth(0.22f))
+	                                     .removeFromTop(proportionOfHeight(0.45f))
+	                                     .reduced(proportionOfWidth(0.01f)));
 
 	//forceValueTreeOntoComponents(false);
 }
@@ -22,6 +22,7 @@
 #include "gui/ADSRComponent.h"
 #include "gui/AmpDistortionFlowComponent.h"
 #include "gui/ArpComponent.h"
+#include "gui/CpuProfilerComponent.h"
 #include "gui/DelayComponent.h"
 #include "gui/DragButton.h"
 #include "gui/FXButtonsSection.h"
@@ -244,6 +245,7 @@ private:
 
 	GlassDropdown m_mono_poly_legato_dropdown;
 	RescaleProgressComponent m_rescale_component;
+	CpuProfilerComponent m_cpu_profiler_overlay;
 
 	OdinButton m_reset;
 
@@ -16,8 +16,11 @@
 #pragma once
 
 #include "../JuceLibraryCode/JuceHeader.h"
+#include "CpuProfiler.h"
 #include "GlobalIncludes.h"
 #include "OdinTreeListener.h"
+#include "ParameterCommandQueue.h"
+#include "RenderQuality.h"
 #include "audio/FX/Chorus.h"
 #include "audio/FX/Delay.h"
 #include "audio/FX/Flanger.h"
@@ -30,8 +33,11 @@
 #include "audio/Filters/Korg35Filter.h"
 #include "audio/Filters/LadderFilter.h"
 #include "audio/Filters/SEMFilter12.h"
+#include "audio/ParameterSmoother.h"
 #include "audio/Oscillators/WavetableContainer.h"
 #include "audio/Voice.h"
+#include "audio/VoiceRenderPool.h"
+#include "audio/Filters/HalfbandDecimator.h"
 #include "gui/DrawableSlider.h"
 #include "gui/OdinKnob.h"
 #include "gui/LeftRightButton.h"
@@ -40,6 +46,7 @@
 #include "gui/OdinButton.h"
 
 #include <list>
+#include <vector>
 
 class OdinEditor;
 
@@ -82,28 +89,69 @@ public:
 	void handleMidiNoteOff(int p_midi_note);
 	void handleMidiNoteOn(int p_midi_note, int p_midi_velocity);
 	void allNotesOff();
+	// queued like a parameter change, the audio thread applies it at the start of the next block
 	void setMonoPolyLegato(PlayModes p_mode);
 	// this should be called when patches are loaded or playmode has changed
 	// .it doesn't change values but clears all buffers
-	// and makes it "untouched"
+	// and makes it "untouched". Queued, see setMonoPolyLegato()
 	void resetAudioEngine();
 	void setFXButtonsPosition(int p_delay, int p_phaser, int p_flanger, int p_chorus, int p_reverb);
 	void attachNonParamListeners();
 	void migratePatch(ValueTree &p_patch);
 	void readPatch(const ValueTree &newState);
+	// sets the maximum length of the sub-blocks processBlock renders in, clamped to 1 ... SUB_BLOCK_SIZE_MAX
+	void setSubBlockSize(int p_size);
+	// spreads the voices across all physical cores but one, or renders them on the audio thread only
+	void setMultiCoreVoiceRendering(bool p_enabled);
+	// message thread or prepareToPlay(), reallocates the voice pool if the number of voices changes
+	void setPolyphony(int p_voices);
+	// makes the random modules of the voices and the global modules reproducible, e.g. for test renders
+	void seedRandom(uint32 p_seed);
+	void setControlRate(int p_samples);
+	// runs the reverb network at half rate in live playback, offline renders always run it at full rate
+	void setReverbHalfRate(bool p_enabled);
+	// per section timings of processBlock, the editor switches it on and reads the loads
+	CpuProfiler &getCpuProfiler() {
+		return m_cpu_profiler;
+	}
 
 	std::function<void()> onSetStateInformation    = []() {};
 	std::function<void(float)> updatePitchWheelGUI = [](float p_value) {};
 	std::function<void(float)> updateModWheelGUI   = [](float p_value) {};
 
 	// this is used to retrigger a held down note if the note after it was released. It stores note and velocity
-	std::list<std::pair<int, int>> m_playmode_mono_note_list;
+	MonoNoteList m_playmode_mono_note_list;
 	Atomic<int> m_step_led_active = -1;
 	Tunings::Tuning m_tuning;
 
 private:
 	void setSampleRate(float p_samplerate);
-	void setFilter3EnvValue();
+	// sets the rate of the voices from the host rate and the oversampling of the patch
+	void updateVoiceOversampling();
+	// the factor updateVoiceOversampling() would set
+	int getVoiceOversampling() const;
+	// replaces the voice pool with p_num_voices new voices and wires them up, not while processBlock() runs. The
+	// parameters have to be replayed afterwards unless they still have their defaults
+	void allocateVoices(int p_num_voices);
+	// ends all notes and clears what the voices left in the buffers
+	void resetVoices();
+	// picks the eco or the high quality profile and applies it to the modules
+	void setRenderQuality(bool p_offline);
+	void setFilter3EnvValue(float p_env_value);
+	void renderSubBlock(float *p_left, float *p_right, int p_num_samples);
+	void renderVoice(int p_voice, float *p_left, float *p_right, int p_num_samples);
+	void renderVoiceGroup(const int *p_voices, int p_num_voices, float *p_left, float *p_right, int p_num_samples);
+	void renderVoiceLanes(const int *p_voices, int p_num_voices, float *p_left, float *p_right, int p_num_samples);
+	void renderVoiceSources(int p_voice, int p_sample);
+	void addVoiceFilterInput(int p_voice, int p_fil, float &pio_input);
+	float renderVoiceFilter(int p_voice, int p_fil, float p_input, int p_sample);
+	void applyVoiceFilterGain(int p_voice, int p_fil, int p_sample);
+	void renderVoiceOutput(int p_voice, int p_sample, int p_voice_sample, bool p_is_newest_voice, float *p_left, float *p_right);
+	void renderFilter3(float *p_left, float *p_right, int p_num_samples);
+	void renderFX(float *p_left, float *p_right, int p_num_samples);
+	// recalculates how long filter 3 and the fx ring out from their current settings
+	void updateTailLength();
+	void applyArpeggiatorEvent(const ArpEvent &p_event);
 	void setBPM(float BPM);
 	void setPitchWheelValue(int p_value);
 	void setModWheelValue(int p_value);
@@ -118,41 +166,58 @@ private:
 	void writeDefaultSpecdrawValuesToTree(int p_osc);
 	void initializeModules();
 
-	void treeValueChangedNonParamFX(ValueTree &tree, const Identifier &identifier);
-	void treeValueChangedNonParamLFO(ValueTree &tree, const Identifier &identifier);
-	void treeValueChangedNonParamMisc(ValueTree &tree, const Identifier &identifier);
-	void treeValueChangedNonParamMod(ValueTree &tree, const Identifier &identifier);
-	void treeValueChangedNonParamOsc(ValueTree &tree, const Identifier &identifier);
-
-	void treeValueChangedOscPitch(const String &p_ID, float p_new_value);
-	void treeValueChangedOscAnalog(const String &p_ID, float p_new_value);
-	void treeValueChangedOscMisc(const String &p_ID, float p_new_value);
-	void treeValueChangedOscMulti(const String &p_ID, float p_new_value);
-	void treeValueChangedOscXY(const String &p_ID, float p_new_value);
-	void treeValueChangedOscChip(const String &p_ID, float p_new_value);
-	void treeValueChangedOscArp(const String &p_ID, float p_new_value);
-	void treeValueChangedOscFM(const String &p_ID, float p_new_value);
-	void treeValueChangedOscNoise(const String &p_ID, float p_new_value);
-	void treeValueChangedFilTop(const String &p_ID, float p_new_value);
-	void treeValueChangedFilCenter(const String &p_ID, float p_new_value);
-	void treeValueChangedFilMisc(const String &p_ID, float p_new_value);
-	void treeValueChangedFilFormant(const String &p_ID, float p_new_value);
-	void treeValueChangedAmp(const String &p_ID, float p_new_value);
-	void treeValueChangedDelay(const String &p_ID, float p_new_value);
-	void treeValueChangedReverb(const String &p_ID, float p_new_value);
-	void treeValueChangedChorus(const String &p_ID, float p_new_value);
-	void treeValueChangedPhaser(const String &p_ID, float p_new_value);
-	void treeValueChangedArp(const String &p_ID, float p_new_value);
-	void treeValueChangedFlanger(const String &p_ID, float p_new_value);
-	void treeValueChangedADSR1(const String &p_ID, float p_new_value);
-	void treeValueChangedADSR2(const String &p_ID, float p_new_value);
-	void treeValueChangedADSR3(const String &p_ID, float p_new_value);
-	void treeValueChangedADSR4(const String &p_ID, float p_new_value);
-	void treeValueChangedLFO1(const String &p_ID, float p_new_value);
-	void treeValueChangedLFO2(const String &p_ID, float p_new_value);
-	void treeValueChangedLFO3(const String &p_ID, float p_new_value);
-	void treeValueChangedLFO4(const String &p_ID, float p_new_value);
-	void treeValueChangedGeneralMisc(const String &p_ID, float p_new_value);
+	// maps every parameter to a slot of the command queue, before the listeners are attached
+	void createParameterSlots();
+	// maps every non param property to a slot of the command queue and fills in the handlers
+	void createParameterCommands();
+	void listenToParameter(const String &p_ID, OdinTreeListener &p_listener);
+	void setParameterHandler(const Identifier &p_ID, std::function<void(float)> p_handler);
+	void setNonParamHandler(const Identifier &p_ID, std::function<void(float)> p_handler);
+	void queueParameterChange(int p_slot, float p_new_value);
+	void queueNonParamChange(ValueTree &p_tree, const Identifier &p_ID);
+	// applies all changes which were queued since the last call, audio thread only
+	void applyParameterCommands();
+	// hands the current value of every parameter and non param property to its handler again, for new voices
+	void replayParameterCommands();
+	// what resetAudioEngine() and setMonoPolyLegato() queue
+	void applyAudioEngineReset();
+	void applyMonoPolyLegato(PlayModes p_mode);
+
+	void addNonParamHandlersFX();
+	void addNonParamHandlersLFO();
+	void addNonParamHandlersMisc();
+	void addNonParamHandlersMod();
+	void addNonParamHandlersOsc();
+
+	void addParameterHandlersOscPitch();
+	void addParameterHandlersOscMisc();
+	void addParameterHandlersOscAnalog();
+	void addParameterHandlersOscMulti();
+	void addParameterHandlersOscXY();
+	void addParameterHandlersOscChip();
+	void addParameterHandlersOscArp();
+	void addParameterHandlersOscFM();
+	void addParameterHandlersOscNoise();
+	void addParameterHandlersFilTop();
+	void addParameterHandlersFilCenter();
+	void addParameterHandlersFilMisc();
+	void addParameterHandlersFilFormant();
+	void addParameterHandlersAmp();
+	void addParameterHandlersDelay();
+	void addParameterHandlersReverb();
+	void addParameterHandlersChorus();
+	void addParameterHandlersPhaser();
+	void addParameterHandlersArp();
+	void addParameterHandlersFlanger();
+	void addParameterHandlersADSR1();
+	void addParameterHandlersADSR2();
+	void addParameterHandlersADSR3();
+	void addParameterHandlersADSR4();
+	void addParameterHandlersLFO1();
+	void addParameterHandlersLFO2();
+	void addParameterHandlersLFO3();
+	void addParameterHandlersLFO4();
+	void addParameterHandlersGeneralMisc();
 
 	VoiceManager m_voice_manager;
 	AudioProcessorValueTreeState m_value_tree;
@@ -202,9 +267,23 @@ private:
 	OdinTreeListenerNonParam m_non_param_listener_mod;
 	OdinTreeListenerNonParam m_non_param_listener_osc;
 
+	// changes to parameters and non param properties wait here until the audio thread applies them. The first slots
+	// belong to the parameters, the non param properties follow. Both are looked up by name once per change, after
+	// that a change is dispatched straight to the handler of its slot
+	ParameterCommandQueue m_parameter_commands;
+	HashMap<String, int> m_parameter_command_slot;
+	HashMap<String, int> m_non_param_command_slot;
+	std::vector<std::function<void(float)>> m_parameter_handler;
+	// commands which are not a parameter follow the non param properties
+	int m_reset_command_slot     = -1;
+	int m_play_mode_command_slot = -1;
+
 	WavetableContainer m_WT_container;
 	OdinArpeggiator m_arpeggiator;
-	Voice m_voice[VOICES];
+	// only the voices of the polyphony are allocated, m_voice points into the pool
+	std::unique_ptr<Voice[]> m_voice_pool;
+	Voice *m_voice   = nullptr;
+	int m_num_voices = 0;
 
 	LadderFilter m_ladder_filter[2];
 	SEMFilter12 m_SEM_filter_12[2];
@@ -230,20 +309,22 @@ private:
 	std::multimap<int, RangedAudioParameter *> m_midi_control_param_map;
 	bool m_midi_learn_parameter_active = false;
 
-	float m_osc_vol_smooth[3]             = {1.f, 1.f, 1.f}; // factor
-	float m_fil_gain_smooth[3]            = {1.f, 1.f, 1.f}; // factor
+	ParameterSmoother m_osc_vol_smooth[3]{{GAIN_SMOOTHIN_FACTOR, 1.f}, {GAIN_SMOOTHIN_FACTOR, 1.f}, {GAIN_SMOOTHIN_FACTOR, 1.f}};
+	ParameterSmoother m_fil_gain_smooth[3]{{GAIN_SMOOTHIN_FACTOR, 1.f}, {GAIN_SMOOTHIN_FACTOR, 1.f}, {GAIN_SMOOTHIN_FACTOR, 1.f}};
+	ParameterSmoother m_fil_freq_smooth[3]{{FILTER_FREQ_SMOOTHING_FACTOR, 20000.f},
+	                                       {FILTER_FREQ_SMOOTHING_FACTOR, 2000.f},
+	                                       {FILTER_FREQ_SMOOTHING_FACTOR, 2000.f}};
+	ParameterSmoother m_pitch_bend_smooth{PITCHBEND_SMOOTHIN_FACTOR, 0.f};
+	ParameterSmoother m_modwheel_smooth{PITCHBEND_SMOOTHIN_FACTOR, 0.f};
+	ParameterSmoother m_x_smooth{PAD_SMOOTHIN_FACTOR, 0.f};
+	ParameterSmoother m_y_smooth{PAD_SMOOTHIN_FACTOR, 0.f};
+	ParameterSmoother m_master_smooth{GAIN_SMOOTHIN_FACTOR, 1.f};
 	float m_osc_vol_control[3]            = {1.f, 1.f, 1.f}; // factor
 	float m_fil_gain_control[3]           = {1.f, 1.f, 1.f}; // factor
 	float m_fil_freq_control[3]           = {20000, 2000, 2000};
-	float m_fil_freq_smooth[3]            = {20000, 2000, 2000};
-	float m_pitch_bend_smooth             = 0.f;
 	float m_pitch_bend_smooth_and_applied = 0.f;
-	float m_modwheel_smooth               = 0.f;
-	float m_x_smooth                      = 0.f;
-	float m_y_smooth                      = 0.f;
 	float m_x_modded                      = 0.f;
 	float m_y_modded                      = 0.f;
-	float m_master_smooth                 = 1.f;
 	float m_master_control                = 1.f; // factor
 
 	int m_last_midi_note = -1;
@@ -291,6 +372,91 @@ private:
 	float *m_x_mod;
 	float *m_y_mod;
 
+	// SUB-BLOCK RENDERING
+	// the control pass of a sub-block stores everything which changes per sample here,
+	// so voices, filter 3 and fx can then each run over the whole sub-block
+	int m_sub_block_size                                 = SUB_BLOCK_SIZE_MAX;
+	float m_osc_vol_block[3][SUB_BLOCK_SIZE_MAX]         = {{0.f}};
+	float m_fil_gain_block[3][SUB_BLOCK_SIZE_MAX]        = {{0.f}};
+	float m_fil_freq_block[3][SUB_BLOCK_SIZE_MAX]        = {{0.f}};
+	float m_pitch_bend_applied_block[SUB_BLOCK_SIZE_MAX] = {0.f};
+	float m_master_block[SUB_BLOCK_SIZE_MAX]             = {0.f};
+	float m_filter3_env_block[SUB_BLOCK_SIZE_MAX]        = {0.f};
+	ModDestMono m_mono_destinations_block[SUB_BLOCK_SIZE_MAX];
+	// mono mod sources as they were when the mod matrix ran for a sample
+	float m_global_env_block[SUB_BLOCK_SIZE_MAX] = {0.f};
+	float m_global_lfo_block[SUB_BLOCK_SIZE_MAX] = {0.f};
+	float m_pitch_bend_block[SUB_BLOCK_SIZE_MAX] = {0.f};
+	float m_modwheel_block[SUB_BLOCK_SIZE_MAX]   = {0.f};
+	float m_x_modded_block[SUB_BLOCK_SIZE_MAX]   = {0.f};
+	float m_y_modded_block[SUB_BLOCK_SIZE_MAX]   = {0.f};
+
+	// per voice copies of the mono sources and the mono values the oscillators read. During the voice pass
+	// every voice only writes its own copy, so voices don't depend on each other while rendering
+	struct VoiceMonoInputs {
+		float global_env         = 0.f;
+		float global_lfo         = 0.f;
+		float pitchwheel         = 0.f;
+		float pitch_bend_applied = 0.f;
+		float modwheel           = 0.f;
+		float x                  = 0.f;
+		float y                  = 0.f;
+		float glide              = 0.f;
+	};
+	VoiceMonoInputs m_voice_mono_inputs[VOICES];
+
+	// MULTI-CORE VOICE RENDERING
+	// each thread of the pool renders its voices into its own buffer, these are summed afterwards
+	VoiceRenderPool m_voice_render_pool;
+	alignas(64) float m_thread_output[VOICE_RENDER_THREADS_MAX][2][SUB_BLOCK_SIZE_MAX * VOICE_OVERSAMPLING_MAX] = {{{0.f}}};
+	int m_render_num_samples = 0;
+	// the pool gets groups of m_render_voices_per_job active voices, a job is the index of its first voice
+	int m_render_active_voices[VOICES] = {0};
+	int m_render_num_active_voices     = 0;
+	int m_render_voices_per_job        = 1;
+
+	// VOICE OVERSAMPLING
+	// the voices run m_voice_oversampling steps per host sample and render into m_voice_output, the sum of all
+	// voices is decimated once before filter 3. The controls of a sample are held for all of its steps. The setting
+	// comes from the patch or the render quality, whichever is higher. The factor used is lowered so the voice rate
+	// stays within MAX_EXPECTED_SAMPLE_RATE
+	int m_voice_oversampling_setting = 1;
+	int m_voice_oversampling         = 1;
+	// the factor changed while voices were playing, see processBlock()
+	bool m_voice_rate_pending = false;
+	// the glide parameter as set, updateVoiceOversampling() adjusts it to the voice rate
+	float m_glide_setting = 0.f;
+	alignas(64) float m_voice_output[2][SUB_BLOCK_SIZE_MAX * VOICE_OVERSAMPLING_MAX] = {{0.f}};
+	VoiceDecimator m_voice_decimator;
+
+	CpuProfiler m_cpu_profiler;
+
+	// RENDER QUALITY
+	// follows isNonRealtime() of the host, checked in prepareToPlay() and at the start of every block
+	bool m_offline_render          = false;
+	RenderQuality m_render_quality = RENDER_QUALITY_ECO;
+	std::atomic<bool> m_reverb_half_rate{false};
+
+	// CONTROL RATE
+	// the mod matrix only runs every m_control_rate samples, the destinations are ramped towards its result in
+	// between. Rows with oscillator or filter outputs as source are still applied every sample
+	std::atomic<int> m_control_rate_setting{CONTROL_RATE_DEFAULT};
+	int m_control_rate         = CONTROL_RATE_DEFAULT;
+	int m_mono_control_counter = 0;
+	ModDestRamp<ModDestMono> m_mono_dest_ramp;
+	int m_voice_control_counter[VOICES] = {0};
+	std::unique_ptr<ModDestRamp<ModDestVoice>[]> m_voice_dest_ramp;
+
+	// SILENCE DETECTION
+	// filter 3 and the fx are skipped once no voice played and their output stayed below FX_TAIL_THRESHOLD for
+	// longer than their tail. m_tail_length is what the host gets, it includes the amp envelope release
+	std::atomic<double> m_tail_length{0.0};
+	int m_fx_tail_samples = 0;
+	int m_silent_samples  = 0;
+
+	// arpeggiator events up to the next midi message, they end the sub-block they fall into
+	ArpEventBuffer m_arp_events;
+
 	int m_delay_position   = 0;
 	int m_phaser_position  = 1;
 	int m_chorus_position  = 2;
@@ -305,30 +471,45 @@ private:
 	bool m_is_standalone_plugin = true; // set true since is is only set after createEditor()
 
 	float m_BPM = 120;
+	// copy of the misc tree property, kept up to date through the parameter command queue
+	int m_unison_voices = 1;
 
 	bool m_force_values_onto_gui = false; // used for loading state and then remembering to force values once
 	                                      // the editor was created
 
-	//the panning distributions for each unison count
-	std::map<int, std::vector<float>> m_unison_pan_positions = {
-	    {1, {0.f}},
-	    {2, {-1.f, 1.f}},
-	    {3, {-1.f, 0.f, 1.f}},
-	    {4, {-1.f, -0.33333f, 0.3333333f, 1.f}},
-	    {6, {-1.f, -0.6f, -0.2f, 0.2f, 0.6f, 1.f}},
-	    {12,
-	     {-1.f, -0.8181f, -0.6363f, -0.45454f, -0.2787f, -0.0909f, 0.0909f, 0.2787f, 0.45454f, 0.6363f, 0.8181f, 1.f}}};
-
-	// map to "shuffle" the unison pan positions to get the detune positions
-	std::map<int, std::vector<int>> m_unison_detune_positions = {{1, {0}},
-	                                                             {2, {0, 1}},
-	                                                             {3, {0, 1, 2}},
-	                                                             //shuffling starts here:
-	                                                             {4, {2, 0, 3, 1}},
-	                                                             {6, {1, 4, 2, 0, 5, 3}},
-	                                                             {12, {3, 9, 6, 10, 7, 4, 0, 11, 5, 1, 8, 2}}};
-	std::map<int, float> m_unison_gain_factors                = {
-        {1, 1.f}, {2, 0.86f}, {3, 0.75f}, {4, 0.65f}, {6, 0.53f}, {12, 0.45f}};
+	//the panning distributions for each unison count, indexed by the count. Only 1, 2, 3, 4, 6 and 12 are used
+	float m_unison_pan_positions[UNISON_VOICES_MAX + 1][UNISON_VOICES_MAX] = {
+	    {},
+	    {0.f},
+	    {-1.f, 1.f},
+	    {-1.f, 0.f, 1.f},
+	    {-1.f, -0.33333f, 0.3333333f, 1.f},
+	    {},
+	    {-1.f, -0.6f, -0.2f, 0.2f, 0.6f, 1.f},
+	    {},
+	    {},
+	    {},
+	    {},
+	    {},
+	    {-1.f, -0.8181f, -0.6363f, -0.45454f, -0.2787f, -0.0909f, 0.0909f, 0.2787f, 0.45454f, 0.6363f, 0.8181f, 1.f}};
+
+	// table to "shuffle" the unison pan positions to get the detune positions
+	int m_unison_detune_positions[UNISON_VOICES_MAX + 1][UNISON_VOICES_MAX] = {{},
+	                                                                           {0},
+	                                                                           {0, 1},
+	                                                                           {0, 1, 2},
+	                                                                           //shuffling starts here:
+	                                                                           {2, 0, 3, 1},
+	                                                                           {},
+	                                                                           {1, 4, 2, 0, 5, 3},
+	                                                                           {},
+	                                                                           {},
+	                                                                           {},
+	                                                                           {},
+	                                                                           {},
+	                                                                           {3, 9, 6, 10, 7, 4, 0, 11, 5, 1, 8, 2}};
+	float m_unison_gain_factors[UNISON_VOICES_MAX + 1] = {
+	    0.f, 1.f, 0.86f, 0.75f, 0.65f, 0.f, 0.53f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.45f};
 #include "AudioVarDeclarations.h"
 	//==============================================================================
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OdinAudioProcessor)
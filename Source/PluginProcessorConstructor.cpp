@@ -16,6 +16,7 @@
 //this file is included from PluginProcessor.cpp to split the class implementation
 
 #include "PluginProcessor.h"
+#include "ConfigFileManager.h"
 
 OdinAudioProcessor::OdinAudioProcessor() :
     AudioProcessor(BusesProperties().withOutput("Output", AudioChannelSet::stereo(), true)),
@@ -24,150 +25,63 @@ OdinAudioProcessor::OdinAudioProcessor() :
                  ),
 #include "ProcessorInitializerList.h" //contains the connection of Identifiers with their strings
 {
+	// the listeners in AudioParameterConnections.h are attached to the command slots of their parameters
+	createParameterSlots();
 #include "AudioParameterConnections.h" // constains the connection between raw float pointers and their ValueTree counter
 	addNonAudioParametersToTree();
 
-#ifdef WTGEN
-	m_voice[0].wavetable_osc[0].passVariablesToWTDisplay = [&](int p_lower, int p_higher, float p_interpol) {
-		if (m_editor_pointer) {
-			m_editor_pointer->m_wavetable_display.setVariables(p_lower, p_higher, p_interpol);
-			m_editor_pointer->m_spectrum_display.setVariables(p_lower, p_higher, p_interpol);
-		}
-	};
-#endif
-
 	m_is_standalone_plugin = (wrapperType == wrapperType_Standalone);
 
-	m_tree_listener_osc_pitch.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscPitch(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_misc.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscMisc(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_analog.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscAnalog(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_multi.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscMulti(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_xy.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscXY(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_chip.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscChip(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_arp.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscArp(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_fm.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscFM(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_noise.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscNoise(p_ID, p_new_value);
-	};
-	m_tree_listener_fil_top.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedFilTop(p_ID, p_new_value);
-	};
-	m_tree_listener_fil_center.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedFilCenter(p_ID, p_new_value);
-	};
-	m_tree_listener_fil_misc.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedFilMisc(p_ID, p_new_value);
-	};
-	m_tree_listener_fil_formant.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedFilFormant(p_ID, p_new_value);
-	};
-	m_tree_listener_amp.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedAmp(p_ID, p_new_value);
-	};
-	m_tree_listener_delay.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedDelay(p_ID, p_new_value);
-	};
-	m_tree_listener_reverb.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedReverb(p_ID, p_new_value);
-	};
-	m_tree_listener_chorus.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedChorus(p_ID, p_new_value);
-	};
-	m_tree_listener_phaser.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedPhaser(p_ID, p_new_value);
-	};
-	m_tree_listener_arp.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedArp(p_ID, p_new_value);
-	};
-	m_tree_listener_flanger.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedFlanger(p_ID, p_new_value);
-	};
-	m_tree_listener_adsr1.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedADSR1(p_ID, p_new_value);
-	};
-	m_tree_listener_adsr2.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedADSR2(p_ID, p_new_value);
-	};
-	m_tree_listener_adsr3.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedADSR3(p_ID, p_new_value);
-	};
-	m_tree_listener_adsr4.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedADSR4(p_ID, p_new_value);
-	};
-	m_tree_listener_lfo1.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedLFO1(p_ID, p_new_value);
-	};
-	m_tree_listener_lfo2.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedLFO2(p_ID, p_new_value);
-	};
-	m_tree_listener_lfo3.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedLFO3(p_ID, p_new_value);
-	};
-	m_tree_listener_lfo4.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedLFO4(p_ID, p_new_value);
-	};
-	m_tree_listener_general_misc.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedGeneralMisc(p_ID, p_new_value);
-	};
-	m_non_param_listener_fx.onValueChange = [&](ValueTree &tree, const Identifier &identifier) {
-		treeValueChangedNonParamFX(tree, identifier);
-	};
-	m_non_param_listener_lfo.onValueChange = [&](ValueTree &tree, const Identifier &identifier) {
-		treeValueChangedNonParamLFO(tree, identifier);
-	};
-	m_non_param_listener_misc.onValueChange = [&](ValueTree &tree, const Identifier &identifier) {
-		treeValueChangedNonParamMisc(tree, identifier);
-	};
-	m_non_param_listener_mod.onValueChange = [&](ValueTree &tree, const Identifier &identifier) {
-		treeValueChangedNonParamMod(tree, identifier);
-	};
-	m_non_param_listener_osc.onValueChange = [&](ValueTree &tree, const Identifier &identifier) {
-		treeValueChangedNonParamOsc(tree, identifier);
-	};
-
-	//distribute WTContainer to audio core
-	for (int i = 0; i < VOICES; ++i) {
-		for (int osc = 0; osc < 3; ++osc) {
-			m_voice[i].analog_osc[osc].setWavetableContainer(&m_WT_container);
-			m_voice[i].wavetable_osc[osc].setWavetableContainer(&m_WT_container);
-			m_voice[i].chiptune_osc[osc].setWavetableContainer(&m_WT_container);
-			m_voice[i].vector_osc[osc].setWavetableContainer(&m_WT_container);
-			m_voice[i].multi_osc[osc].setWavetableContainer(&m_WT_container);
-			m_voice[i].fm_osc[osc].setWavetableContainer(&m_WT_container);
-			m_voice[i].pm_osc[osc].setWavetableContainer(&m_WT_container);
-			m_voice[i].wavedraw_osc[osc].setWavetableContainer(&m_WT_container);
-			m_voice[i].chipdraw_osc[osc].setWavetableContainer(&m_WT_container);
-			m_voice[i].specdraw_osc[osc].setWavetableContainer(&m_WT_container);
-			m_voice[i].lfo[osc].setWavetableContainer(&m_WT_container);
-		}
-		m_voice[i].setTuningPtr(&m_tuning);
-
-		m_voice[i].ring_mod[0].setWavetableContainer(&m_WT_container);
-		m_voice[i].ring_mod[1].setWavetableContainer(&m_WT_container);
+	OdinTreeListener *tree_listener[] = {&m_tree_listener_osc_pitch,
+	                                     &m_tree_listener_osc_misc,
+	                                     &m_tree_listener_osc_analog,
+	                                     &m_tree_listener_osc_multi,
+	                                     &m_tree_listener_osc_xy,
+	                                     &m_tree_listener_osc_chip,
+	                                     &m_tree_listener_osc_arp,
+	                                     &m_tree_listener_osc_fm,
+	                                     &m_tree_listener_osc_noise,
+	                                     &m_tree_listener_fil_top,
+	                                     &m_tree_listener_fil_center,
+	                                     &m_tree_listener_fil_misc,
+	                                     &m_tree_listener_fil_formant,
+	                                     &m_tree_listener_amp,
+	                                     &m_tree_listener_delay,
+	                                     &m_tree_listener_reverb,
+	                                     &m_tree_listener_chorus,
+	                                     &m_tree_listener_phaser,
+	                                     &m_tree_listener_arp,
+	                                     &m_tree_listener_flanger,
+	                                     &m_tree_listener_adsr1,
+	                                     &m_tree_listener_adsr2,
+	                                     &m_tree_listener_adsr3,
+	                                     &m_tree_listener_adsr4,
+	                                     &m_tree_listener_lfo1,
+	                                     &m_tree_listener_lfo2,
+	                                     &m_tree_listener_lfo3,
+	                                     &m_tree_listener_lfo4,
+	                                     &m_tree_listener_general_misc};
+	for (auto listener : tree_listener) {
+		listener->onValueChange = [&](int p_slot, float p_new_value) { queueParameterChange(p_slot, p_new_value); };
+	}
+	OdinTreeListenerNonParam *non_param_listener[] = {&m_non_param_listener_fx,
+	                                                  &m_non_param_listener_lfo,
+	                                                  &m_non_param_listener_misc,
+	                                                  &m_non_param_listener_mod,
+	                                                  &m_non_param_listener_osc};
+	for (auto listener : non_param_listener) {
+		listener->onValueChange = [&](ValueTree &tree, const Identifier &identifier) {
+			queueNonParamChange(tree, identifier);
+		};
 	}
+	createParameterCommands();
+
 	m_ring_mod[0].setWavetableContainer(&m_WT_container);
 	m_ring_mod[1].setWavetableContainer(&m_WT_container);
 
 	m_global_lfo.setWavetableContainer(&m_WT_container);
 
 	initializeModules();
-	m_WT_container.loadWavetablesFromConstData();
 
 	// create draw tables
 	float draw_values[WAVEDRAW_STEPS_X];
@@ -190,32 +104,6 @@ OdinAudioProcessor::OdinAudioProcessor() :
 		m_WT_container.createSpecdrawTable(osc, spec_values, 44100);
 	}
 
-	// load wavetables into oscs
-	for (int i = 0; i < VOICES; ++i) {
-		for (int osc = 0; osc < 3; ++osc) {
-			m_voice[i].analog_osc[osc].loadWavetables();
-			m_voice[i].wavetable_osc[osc].loadWavetables();
-			m_voice[i].chiptune_osc[osc].loadWavetables();
-			m_voice[i].vector_osc[osc].loadWavetables();
-			m_voice[i].multi_osc[osc].loadWavetables();
-			m_voice[i].fm_osc[osc].loadWavetables();
-			m_voice[i].pm_osc[osc].loadWavetables();
-			m_voice[i].wavedraw_osc[osc].loadWavedrawTables(osc);
-			m_voice[i].chipdraw_osc[osc].loadChipdrawTables(osc);
-			m_voice[i].specdraw_osc[osc].loadSpecdrawTables(osc);
-			m_voice[i].lfo[osc].loadWavetables();
-		}
-		m_voice[i].ring_mod[0].loadWavetables();
-		m_voice[i].ring_mod[1].loadWavetables();
-		m_voice[i].ring_mod[0].selectWavetable(0);
-		m_voice[i].ring_mod[1].selectWavetable(0);
-
-		// set different initial values for filter and mod env here....not best solution
-		m_voice[i].env[1].setDecay(0.8f);
-		m_voice[i].env[1].setSustain(0);
-		m_voice[i].env[2].setDecay(0.8f);
-		m_voice[i].env[2].setSustain(0);
-	}
 	m_ring_mod[0].loadWavetables();
 	m_ring_mod[1].loadWavetables();
 	m_ring_mod[0].selectWavetable(0);
@@ -223,11 +111,17 @@ OdinAudioProcessor::OdinAudioProcessor() :
 
 	m_global_lfo.loadWavetables();
 
-	for (int voice = 0; voice < VOICES; ++voice) {
-		m_voice[voice].env[0].setEnvelopeEndPointers(&(m_voice[voice].m_voice_active),
-		                                             &(m_voice_manager.voice_busy[voice]));
-		m_voice_manager.m_actual_voice_pointers[voice] = &(m_voice[voice]);
-	}
+	// only as many voices as the polyphony are allocated, the parameters still have their defaults here
+	allocateVoices(jlimit(VOICES_MIN, VOICES, ConfigFileManager::getInstance().getOptionPolyphony()));
+
+	// voices rendered by the pool go into the buffer of the thread they run on
+	m_voice_render_pool.renderJob = [&](int p_first_voice, int p_thread_index) {
+		renderVoiceGroup(m_render_active_voices + p_first_voice,
+		                 jmin(m_render_voices_per_job, m_render_num_active_voices - p_first_voice),
+		                 m_thread_output[p_thread_index][0],
+		                 m_thread_output[p_thread_index][1],
+		                 m_render_num_samples);
+	};
 
 	// set mod sources to render from modmatrix
 	m_mod_matrix.setSourcesToRender =
@@ -253,7 +147,7 @@ OdinAudioProcessor::OdinAudioProcessor() :
 	    };
 
 	m_master_control = Decibels::decibelsToGain(-7.f);
-	m_master_smooth  = m_master_control;
+	m_master_smooth.reset(m_master_control);
 }
 
 OdinAudioProcessor::~OdinAudioProcessor() {
@@ -64,11 +64,7 @@ void OdinAudioProcessor::midiNoteOn(
 
 	if (m_mono_poly_legato != PlayModes::Poly && p_add_to_mono_list) {
 		//append note to list, we ignore sustain here for simplicity
-		m_playmode_mono_note_list.push_back(std::make_pair(p_midi_note, p_midi_velocity));
-		//DBG("List:");
-		//for (auto const &i : m_playmode_mono_note_list) {
-		//	DBG(i.first);
-		//}
+		m_playmode_mono_note_list.push_back(p_midi_note, p_midi_velocity);
 	}
 
 	if (m_mono_poly_legato != PlayModes::Retrig) {
@@ -94,13 +90,15 @@ void OdinAudioProcessor::midiNoteOn(
 	}
 
 	int unison_counter = 0;
-	int unison_voices  = m_value_tree.state.getChildWithName("misc")["unison_voices"];
-	auto voice_numbers = m_voice_manager.getVoices(p_midi_note, unison_voices);
+	int unison_voices  = m_unison_voices;
+	int voice_numbers[VOICES];
+	const int num_voices = m_voice_manager.getVoices(p_midi_note, unison_voices, voice_numbers);
 	if (m_last_midi_note == -1) {
 		// first time glide - dont glide
 		m_last_midi_note = p_midi_note;
 	}
-	for (int new_voice : voice_numbers) {
+	for (int index = 0; index < num_voices; ++index) {
+		const int new_voice = voice_numbers[index];
 		m_voice[new_voice].start(
 		    p_midi_note,
 		    p_midi_velocity,
@@ -113,6 +111,10 @@ void OdinAudioProcessor::midiNoteOn(
 		    p_arp_mod_1,
 		    p_arp_mod_2);
 		m_voice[new_voice].amp.setMIDIVelocity(p_midi_velocity);
+		m_voice_manager.addActiveVoice(new_voice);
+		// the modulation of the new note starts without a ramp from the last one
+		m_voice_control_counter[new_voice] = 0;
+		m_voice_dest_ramp[new_voice].jump();
 		m_mod_matrix.setMostRecentVoice(new_voice);
 		++unison_counter;
 	}
@@ -141,34 +143,22 @@ void OdinAudioProcessor::midiNoteOff(int p_midi_note) {
 	if (m_mono_poly_legato != PlayModes::Poly) {
 
 		//remove note from mono note list
-		bool note_killed_is_most_recent = false;
-		for (auto note_it = m_playmode_mono_note_list.begin(); note_it != m_playmode_mono_note_list.end(); note_it++) {
-			if (note_it->first == p_midi_note) {
-				note_killed_is_most_recent = (note_it->first == m_playmode_mono_note_list.back().first);
-				m_playmode_mono_note_list.erase(note_it);
-				break;
-			}
-		}
-
-		//DBG("List:");
-		//for (auto const &i : m_playmode_mono_note_list) {
-		//	DBG(i.first);
-		//}
+		const bool note_killed_is_most_recent = m_playmode_mono_note_list.remove(p_midi_note);
 
 		//if mono/legato && killed note is the one playing && note list not empty, we play the most recent pressed key again
 		if (!m_playmode_mono_note_list.empty() && note_killed_is_most_recent) {
-			midiNoteOn(m_playmode_mono_note_list.back().first, m_playmode_mono_note_list.back().second, 0, 0, false);
+			midiNoteOn(m_playmode_mono_note_list.backNote(), m_playmode_mono_note_list.backVelocity(), 0, 0, false);
 		}
 	}
 
 	if (!m_voice_manager.getSustainActive()) {
-		for (int voice = 0; voice < VOICES; ++voice) {
+		for (int voice = 0; voice < m_num_voices; ++voice) {
 			if (m_voice[voice].keyUp(p_midi_note)) {
 				//DBG("KeyUp on voice " + std::to_string(voice));
 			}
 		}
 	} else {
-		for (int voice = 0; voice < VOICES; ++voice) {
+		for (int voice = 0; voice < m_num_voices; ++voice) {
 			if (m_voice[voice].usesThisMIDIKey(p_midi_note)) {
 				m_voice_manager.addToKillList(voice, p_midi_note);
 			}
@@ -197,11 +187,9 @@ void OdinAudioProcessor::handleMidiMessage(const MidiMessage &p_midi_message) {
 		} else {
 			m_voice_manager.setSustainActive(true);
 		}
-		DBG("Sustain pedal pressed");
 	} else if (p_midi_message.isSustainPedalOff()) {
-		DBG("Sustain pedal released");
 		m_voice_manager.setSustainActive(false);
-		for (int voice = 0; voice < VOICES; ++voice) {
+		for (int voice = 0; voice < m_num_voices; ++voice) {
 			if (m_voice_manager.isOnKillList(voice)) {
 				m_voice[voice].startRelease();
 			}
@@ -211,9 +199,7 @@ void OdinAudioProcessor::handleMidiMessage(const MidiMessage &p_midi_message) {
 		checkEndGlobalEnvelope();
 	} else if (p_midi_message.isAftertouch()) {
 		// todo this is untested
-		DBG("receiving afterouch, note: " + std::to_string(p_midi_message.getNoteNumber()) +
-		    ", value: " + std::to_string((float)p_midi_message.getAfterTouchValue() / 127.f));
-		for (int voice = 0; voice < VOICES; ++voice) {
+		for (int voice = 0; voice < m_num_voices; ++voice) {
 			m_voice[voice].setAftertouch(p_midi_message.getNoteNumber(),
 			                             (float)p_midi_message.getAfterTouchValue() / 127.f);
 		}
@@ -242,7 +228,7 @@ WavetableContainer *OdinAudioProcessor::getWavetableContainerPointer() {
 }
 
 void OdinAudioProcessor::allNotesOff() {
-	for (int voice = 0; voice < VOICES; ++voice) {
+	for (int voice = 0; voice < m_num_voices; ++voice) {
 		m_voice[voice].forceKeyUp();
 	}
 	m_arpeggiator.endPlayingNotes();
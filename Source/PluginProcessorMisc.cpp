@@ -16,13 +16,14 @@
 //this file is included from PluginProcessor.cpp to split the class implementation
 
 #include "PluginProcessor.h"
+#include "ConfigFileManager.h"
 
 const String OdinAudioProcessor::getName() const {
 	return JucePlugin_Name;
 }
 
 double OdinAudioProcessor::getTailLengthSeconds() const {
-	return 0.0;
+	return m_tail_length.load();
 }
 
 int OdinAudioProcessor::getNumPrograms() {
@@ -47,12 +48,28 @@ void OdinAudioProcessor::changeProgramName(int index, const String &newName) {
 
 //==============================================================================
 void OdinAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock) {
+	// first, so the sample rate and render quality below reach a reallocated voice pool
+	setPolyphony(ConfigFileManager::getInstance().getOptionPolyphony());
 	setSampleRate(sampleRate);
+	setRenderQuality(isNonRealtime());
+	// nothing is playing yet, so the voice rate of the new profile can be set right away
+	if (m_voice_rate_pending) {
+		updateVoiceOversampling();
+	}
+	m_cpu_profiler.setSampleRate(sampleRate);
+	// the audio thread is not running, so changes queued while it was stopped are applied right away
+	applyParameterCommands();
+	m_WT_container.applyStagedDrawTables();
+	updateTailLength();
+	setMultiCoreVoiceRendering(ConfigFileManager::getInstance().getOptionMultiCoreVoices());
+	setControlRate(ConfigFileManager::getInstance().getOptionControlRate());
+	setReverbHalfRate(ConfigFileManager::getInstance().getOptionReverbHalfRate());
 }
 
 void OdinAudioProcessor::releaseResources() {
 	// When playback stops, you can use this as an opportunity to free up any
 	// spare memory, etc.
+	m_voice_render_pool.setNumHelperThreads(0);
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -188,9 +205,7 @@ void OdinAudioProcessor::setSampleRate(float p_samplerate) {
 
 	m_samplerate = p_samplerate;
 
-	for (int voice = 0; voice < VOICES; ++voice) {
-		m_voice[voice].setSampleRate(p_samplerate);
-	}
+	updateVoiceOversampling();
 	for (int stereo = 0; stereo < 2; ++stereo) {
 		m_flanger[stereo].setSampleRate(p_samplerate);
 		m_chorus[stereo].setSampleRate(p_samplerate);
@@ -211,14 +226,143 @@ void OdinAudioProcessor::setSampleRate(float p_samplerate) {
 	m_global_env.setSampleRate(p_samplerate);
 	m_global_lfo.setSampleRate(p_samplerate);
 	m_arpeggiator.setSampleRate(p_samplerate);
+}
+
+int OdinAudioProcessor::getVoiceOversampling() const {
+	// the comb filters of the voices only have room for MAX_EXPECTED_SAMPLE_RATE
+	int factor = jmax(m_voice_oversampling_setting, m_render_quality.voice_oversampling);
+	while (factor > 1 && m_samplerate * factor > MAX_EXPECTED_SAMPLE_RATE) {
+		factor /= 2;
+	}
+	return factor;
+}
+
+void OdinAudioProcessor::updateVoiceOversampling() {
+	const int factor     = getVoiceOversampling();
+	m_voice_oversampling = factor;
+	m_voice_decimator.setFactor(factor);
+
+	const float voice_samplerate = m_samplerate * factor;
+	m_voice_rate_pending         = false;
 
 	//update glide
-	float glide_samplerate_adjusted = pow(GETAUDIO("glide"), 44800. / m_samplerate);
-	for (int voice = 0; voice < VOICES; ++voice) {
+	float glide_samplerate_adjusted = pow(m_glide_setting, 44800. / voice_samplerate);
+	for (int voice = 0; voice < m_num_voices; ++voice) {
+		m_voice[voice].setSampleRate(voice_samplerate);
+		m_voice[voice].setInternalOversampling(factor == 1);
 		m_voice[voice].setGlide(glide_samplerate_adjusted);
 	}
 }
 
+void OdinAudioProcessor::allocateVoices(int p_num_voices) {
+	// the old pool goes first, so both are never allocated at once
+	m_voice      = nullptr;
+	m_num_voices = 0;
+	m_voice_pool.reset();
+	m_voice_dest_ramp.reset();
+	m_voice_pool.reset(new Voice[p_num_voices]);
+	m_voice_dest_ramp.reset(new ModDestRamp<ModDestVoice>[p_num_voices]);
+	m_voice      = m_voice_pool.get();
+	m_num_voices = p_num_voices;
+
+	for (int voice = 0; voice < m_num_voices; ++voice) {
+		for (int osc = 0; osc < 3; ++osc) {
+			m_voice[voice].analog_osc[osc].setWavetableContainer(&m_WT_container);
+			m_voice[voice].wavetable_osc[osc].setWavetableContainer(&m_WT_container);
+			m_voice[voice].chiptune_osc[osc].setWavetableContainer(&m_WT_container);
+			m_voice[voice].vector_osc[osc].setWavetableContainer(&m_WT_container);
+			m_voice[voice].multi_osc[osc].setWavetableContainer(&m_WT_container);
+			m_voice[voice].fm_osc[osc].setWavetableContainer(&m_WT_container);
+			m_voice[voice].pm_osc[osc].setWavetableContainer(&m_WT_container);
+			m_voice[voice].wavedraw_osc[osc].setWavetableContainer(&m_WT_container);
+			m_voice[voice].chipdraw_osc[osc].setWavetableContainer(&m_WT_container);
+			m_voice[voice].specdraw_osc[osc].setWavetableContainer(&m_WT_container);
+			m_voice[voice].lfo[osc].setWavetableContainer(&m_WT_container);
+
+			m_voice[voice].analog_osc[osc].loadWavetables();
+			m_voice[voice].wavetable_osc[osc].loadWavetables();
+			m_voice[voice].chiptune_osc[osc].loadWavetables();
+			m_voice[voice].vector_osc[osc].loadWavetables();
+			m_voice[voice].multi_osc[osc].loadWavetables();
+			m_voice[voice].fm_osc[osc].loadWavetables();
+			m_voice[voice].pm_osc[osc].loadWavetables();
+			m_voice[voice].wavedraw_osc[osc].loadWavedrawTables(osc);
+			m_voice[voice].chipdraw_osc[osc].loadChipdrawTables(osc);
+			m_voice[voice].specdraw_osc[osc].loadSpecdrawTables(osc);
+			m_voice[voice].lfo[osc].loadWavetables();
+		}
+		m_voice[voice].setTuningPtr(&m_tuning);
+
+		m_voice[voice].ring_mod[0].setWavetableContainer(&m_WT_container);
+		m_voice[voice].ring_mod[1].setWavetableContainer(&m_WT_container);
+		m_voice[voice].ring_mod[0].loadWavetables();
+		m_voice[voice].ring_mod[1].loadWavetables();
+		m_voice[voice].ring_mod[0].selectWavetable(0);
+		m_voice[voice].ring_mod[1].selectWavetable(0);
+
+		// set different initial values for filter and mod env here....not best solution
+		m_voice[voice].env[1].setDecay(0.8f);
+		m_voice[voice].env[1].setSustain(0);
+		m_voice[voice].env[2].setDecay(0.8f);
+		m_voice[voice].env[2].setSustain(0);
+
+		// set analog osc as sync osc for start
+		//todo these are probably set wrongly on plugin load....
+		m_voice[voice].setOscSyncOscillator(&(m_voice[voice].analog_osc[0]));
+
+		m_voice[voice].env[0].setEnvelopeEndPointers(&(m_voice[voice].m_voice_active),
+		                                             &(m_voice_manager.voice_busy[voice]));
+		m_voice_manager.m_actual_voice_pointers[voice] = &(m_voice[voice]);
+
+		m_voice[voice].setMonoPolyLegato(m_mono_poly_legato);
+		m_voice[voice].setCubicInterpolation(m_render_quality.cubic_interpolation);
+	}
+	for (int voice = m_num_voices; voice < VOICES; ++voice) {
+		m_voice_manager.m_actual_voice_pointers[voice] = nullptr;
+	}
+
+#ifdef WTGEN
+	m_voice[0].wavetable_osc[0].passVariablesToWTDisplay = [&](int p_lower, int p_higher, float p_interpol) {
+		if (m_editor_pointer) {
+			m_editor_pointer->m_wavetable_display.setVariables(p_lower, p_higher, p_interpol);
+			m_editor_pointer->m_spectrum_display.setVariables(p_lower, p_higher, p_interpol);
+		}
+	};
+#endif
+
+	setModulationPointers();
+	updateVoiceOversampling();
+
+	m_voice_manager.setPolyphony(m_num_voices);
+	m_voice_manager.reset();
+	memset(m_osc_output, 0, sizeof(m_osc_output));
+	memset(m_filter_output, 0, sizeof(m_filter_output));
+	memset(m_voice_control_counter, 0, sizeof(m_voice_control_counter));
+}
+
+void OdinAudioProcessor::resetVoices() {
+	for (int voice = 0; voice < m_num_voices; ++voice) {
+		m_voice[voice].hardReset();
+	}
+	m_voice_manager.reset();
+	memset(m_osc_output, 0, sizeof(m_osc_output));
+	memset(m_filter_output, 0, sizeof(m_filter_output));
+}
+
+void OdinAudioProcessor::setRenderQuality(bool p_offline) {
+	m_offline_render = p_offline;
+	m_render_quality = p_offline ? RENDER_QUALITY_HIGH : RENDER_QUALITY_ECO;
+
+	for (int voice = 0; voice < m_num_voices; ++voice) {
+		m_voice[voice].setCubicInterpolation(m_render_quality.cubic_interpolation);
+	}
+	m_reverb_zita.setHalfRate(m_reverb_half_rate.load() && !p_offline);
+	// the control rate is picked up by processBlock()
+
+	// the envelopes would restart at the new rate, so processBlock() waits until no voice plays
+	m_voice_rate_pending = getVoiceOversampling() != m_voice_oversampling;
+}
+
 void OdinAudioProcessor::initializeModules() {
 	m_global_env.reset();
 	m_global_env.setEnvelopeOff(); // so it doesn't start by itself
@@ -232,12 +376,6 @@ void OdinAudioProcessor::initializeModules() {
 	m_flanger[1].setLFOResetPos(0.5);
 
 	setModulationPointers();
-
-	// set analog osc as sync osc for start
-	for (int voice = 0; voice < VOICES; ++voice) {
-		//todo these are probably set wrongly on plugin load....
-		m_voice[voice].setOscSyncOscillator(&(m_voice[voice].analog_osc[0]));
-	}
 }
 
 void OdinAudioProcessor::setPitchWheelValue(int p_value) {
@@ -251,7 +389,7 @@ void OdinAudioProcessor::setModWheelValue(int p_value) {
 }
 
 void OdinAudioProcessor::checkEndGlobalEnvelope() {
-	for (int voice = 0; voice < VOICES; ++voice) {
+	for (int voice = 0; voice < m_num_voices; ++voice) {
 		if (m_voice[voice] && m_voice[voice].env[0].isBeforeRelease()) {
 			// dont kill it
 			return;
@@ -263,10 +401,12 @@ void OdinAudioProcessor::checkEndGlobalEnvelope() {
 }
 
 void OdinAudioProcessor::resetAudioEngine() {
+	// the voice lists must not change under the audio thread
+	m_parameter_commands.push(m_reset_command_slot, 1.f);
+}
 
-	for (int voice = 0; voice < VOICES; ++voice) {
-		m_voice[voice].hardReset();
-	}
+void OdinAudioProcessor::applyAudioEngineReset() {
+	resetVoices();
 	for (int stereo = 0; stereo < 2; ++stereo) {
 		m_ladder_filter[stereo].reset();
 		m_SEM_filter_12[stereo].reset();
@@ -283,12 +423,10 @@ void OdinAudioProcessor::resetAudioEngine() {
 	m_phaser.reset();
 	m_global_lfo.reset();
 	m_global_env.reset();
-
-	m_voice_manager.reset();
 }
 
 void OdinAudioProcessor::setBPM(float p_BPM) {
-	for (int voice = 0; voice < VOICES; ++voice) {
+	for (int voice = 0; voice < m_num_voices; ++voice) {
 		m_voice[voice].setBPM(p_BPM, m_lfo1_sync, m_lfo2_sync, m_lfo3_sync);
 	}
 	if (m_delay_sync) {
@@ -320,25 +458,60 @@ void OdinAudioProcessor::setFXButtonsPosition(int p_delay, int p_phaser, int p_f
 	m_reverb_position  = p_reverb;
 }
 
-void OdinAudioProcessor::setFilter3EnvValue() {
+void OdinAudioProcessor::setSubBlockSize(int p_size) {
+	m_sub_block_size = p_size < 1 ? 1 : (p_size > SUB_BLOCK_SIZE_MAX ? SUB_BLOCK_SIZE_MAX : p_size);
+}
+
+void OdinAudioProcessor::setMultiCoreVoiceRendering(bool p_enabled) {
+	m_voice_render_pool.setNumHelperThreads(p_enabled ? SystemStats::getNumPhysicalCpus() - 1 : 0);
+}
+
+void OdinAudioProcessor::setPolyphony(int p_voices) {
+	const int polyphony = jlimit(VOICES_MIN, VOICES, p_voices);
+	if (polyphony == m_num_voices) {
+		return;
+	}
+	// the pool only holds the voices of the polyphony, processBlock() is kept out while it is rebuilt
+	const bool was_suspended = isSuspended();
+	suspendProcessing(true);
+	allocateVoices(polyphony);
+	replayParameterCommands();
+	suspendProcessing(was_suspended);
+}
+
+void OdinAudioProcessor::seedRandom(uint32 p_seed) {
+	for (int voice = 0; voice < m_num_voices; ++voice) {
+		m_voice[voice].seedRandom(p_seed * VOICES + voice);
+	}
+	m_global_lfo.seedRandom(~p_seed);
+	m_ring_mod[0].seedRandom(~p_seed + 1);
+	m_ring_mod[1].seedRandom(~p_seed + 2);
+}
 
-	// get adsr value newest voice filterenv
-	float env_value = m_adsr[m_voice_manager.getNewestVoiceIndex()][1];
+void OdinAudioProcessor::setControlRate(int p_samples) {
+	m_control_rate_setting.store(jlimit(1, CONTROL_RATE_MAX, p_samples));
+}
 
-	m_ladder_filter[0].m_env_value  = env_value;
-	m_SEM_filter_12[0].m_env_value  = env_value;
-	m_korg_filter[0].m_env_value    = env_value;
-	m_diode_filter[0].m_env_value   = env_value;
-	m_comb_filter[0].m_env_value    = env_value;
-	m_formant_filter[0].m_env_value = env_value;
-	m_ring_mod[0].m_env_value       = env_value;
-	m_ladder_filter[1].m_env_value  = env_value;
-	m_SEM_filter_12[1].m_env_value  = env_value;
-	m_korg_filter[1].m_env_value    = env_value;
-	m_diode_filter[1].m_env_value   = env_value;
-	m_comb_filter[1].m_env_value    = env_value;
-	m_formant_filter[1].m_env_value = env_value;
-	m_ring_mod[1].m_env_value       = env_value;
+void OdinAudioProcessor::setReverbHalfRate(bool p_enabled) {
+	m_reverb_half_rate.store(p_enabled);
+}
+
+// p_env_value is the filter envelope of the newest voice
+void OdinAudioProcessor::setFilter3EnvValue(float p_env_value) {
+	m_ladder_filter[0].m_env_value  = p_env_value;
+	m_SEM_filter_12[0].m_env_value  = p_env_value;
+	m_korg_filter[0].m_env_value    = p_env_value;
+	m_diode_filter[0].m_env_value   = p_env_value;
+	m_comb_filter[0].m_env_value    = p_env_value;
+	m_formant_filter[0].m_env_value = p_env_value;
+	m_ring_mod[0].m_env_value       = p_env_value;
+	m_ladder_filter[1].m_env_value  = p_env_value;
+	m_SEM_filter_12[1].m_env_value  = p_env_value;
+	m_korg_filter[1].m_env_value    = p_env_value;
+	m_diode_filter[1].m_env_value   = p_env_value;
+	m_comb_filter[1].m_env_value    = p_env_value;
+	m_formant_filter[1].m_env_value = p_env_value;
+	m_ring_mod[1].m_env_value       = p_env_value;
 }
 
 void OdinAudioProcessor::attachNonParamListeners() {
@@ -356,15 +529,19 @@ void OdinAudioProcessor::onEditorDestruction() {
 }
 
 void OdinAudioProcessor::setMonoPolyLegato(PlayModes p_mode) {
+	m_parameter_commands.push(m_play_mode_command_slot, (float)p_mode);
+}
+
+void OdinAudioProcessor::applyMonoPolyLegato(PlayModes p_mode) {
 	m_mono_poly_legato = p_mode;
 
 	bool legato_was_changed = m_voice_manager.setMonoPolyLegato(p_mode);
-	for (int voice = 0; voice < VOICES; ++voice) {
+	for (int voice = 0; voice < m_num_voices; ++voice) {
 		m_voice[voice].setMonoPolyLegato(p_mode);
 	}
 
 	if (legato_was_changed) {
-		resetAudioEngine();
+		applyAudioEngineReset();
 		m_playmode_mono_note_list.clear();
 	}
 }
\ No newline at end of file
@@ -92,6 +92,7 @@ void OdinAudioProcessor::addNonAudioParametersToTree() {
 	// this is patch version
 	node.setProperty("patch_migration_version", ODIN_PATCH_MIGRATION_VERSION, nullptr);
 	node.setProperty("dist_on", 0, nullptr);
+	node.setProperty("voice_oversampling", 1, nullptr);
 	node.setProperty("fil1_comb_polarity", 0, nullptr);
 	node.setProperty("fil2_comb_polarity", 0, nullptr);
 	node.setProperty("fil3_comb_polarity", 0, nullptr);
@@ -16,19 +16,55 @@
 //this file is included from PluginProcessor.cpp to split the class implementation
 
 #include "PluginProcessor.h"
+#include "CpuProfiler.h"
+#include "RealtimeChecker.h"
+#include "audio/Filters/LadderFilterLanes.h"
 
 void OdinAudioProcessor::processBlock(AudioBuffer<float> &buffer, MidiBuffer &midiMessages) {
 
+	// reports allocations, locks and file access from here on in builds with ODIN_RT_CHECK
+	RealtimeChecker::ScopedSection realtime_section;
+	m_cpu_profiler.beginBlock();
+
 	//avoid denormals
 	juce::ScopedNoDenormals snd;
 
+	// parameter changes and new draw tables from other threads are applied here, before anything reads them
+	applyParameterCommands();
+	m_WT_container.applyStagedDrawTables();
+
+	// hosts can switch to offline rendering without calling prepareToPlay() again
+	if (isNonRealtime() != m_offline_render) {
+		setRenderQuality(isNonRealtime());
+	}
+	// a new voice rate would restart the envelopes of playing notes, so it waits until all voices are free
+	if (m_voice_rate_pending && m_voice_manager.getNumActiveVoices() == 0) {
+		updateVoiceOversampling();
+	}
+	// only reconfigures the reverb when the option was switched, which clears its tail
+	m_reverb_zita.setHalfRate(m_reverb_half_rate.load() && !m_offline_render);
+
+	updateTailLength();
+
+	// the mod matrix is compiled here when its rows changed
+	const bool routes_changed = m_mod_matrix.updateRoutes();
+	const int control_rate =
+	    m_render_quality.control_rate > 0 ? m_render_quality.control_rate : m_control_rate_setting.load();
+	if (routes_changed || m_control_rate != control_rate) {
+		// restart all ramps, their values might be from long ago or belong to destinations without a route now
+		m_control_rate         = control_rate;
+		m_mono_control_counter = 0;
+		m_mono_dest_ramp.jump();
+		for (int voice = 0; voice < m_num_voices; ++voice) {
+			m_voice_control_counter[voice] = 0;
+			m_voice_dest_ramp[voice].jump();
+		}
+	}
+
 	// get BPM info from host
 	if (AudioPlayHead *playhead = getPlayHead()) {
 		AudioPlayHead::CurrentPositionInfo current_position_info;
 		playhead->getCurrentPosition(current_position_info);
-		if (m_BPM != current_position_info.bpm) {
-			m_value_tree.state.getChildWithName("misc").setProperty("BPM", m_BPM, nullptr);
-		}
 		m_BPM = current_position_info.bpm;
 	}
 	setBPM(m_BPM);
@@ -46,88 +82,170 @@ void OdinAudioProcessor::processBlock(AudioBuffer<float> &buffer, MidiBuffer &mi
 		midi_message_sample = (*midi_iterator).samplePosition;
 	}
 
-	// loop over samples
-	for (int sample = 0; sample < buffer.getNumSamples(); ++sample) {
+	float *output_left  = buffer.getWritePointer(0);
+	float *output_right = buffer.getWritePointer(1);
+	const int num_samples = buffer.getNumSamples();
 
-		// do Arpeggiator
-		if (m_arpeggiator_on) {
-			int step_active;
-			auto note = m_arpeggiator.getNoteOns(step_active);
-			m_step_led_active.set(step_active);
-			if (std::get<0>(note) != -1) {
-				midiNoteOn(std::get<0>(note), std::get<1>(note), std::get<2>(note), std::get<3>(note));
-			}
-			auto off_notes = m_arpeggiator.getNoteOffs();
-			for (auto note_to_kill : off_notes) {
-				midiNoteOff(note_to_kill);
+	// the arpeggiator is processed from one midi event to the next, its events are in m_arp_events
+	int arp_start       = 0;
+	int arp_end         = 0;
+	int arp_event_index = 0;
+
+	// render the buffer in sub-blocks which end at the next midi or arpeggiator event, so all modules can
+	// process a run of samples at once while notes are still started sample accurate
+	int sub_block_start = 0;
+	m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::Parameters);
+	while (sub_block_start < num_samples) {
+
+		//============================================================
+		//========================== MIDI ============================
+		//============================================================
+		while (midi_message_remaining && midi_message_sample <= sub_block_start) {
+			handleMidiMessage(midi_message);
+			// get next midi message
+			midi_iterator++;
+			midi_message_remaining = (midi_iterator != midiMessages.end());
+			if (midi_message_remaining) {
+				midi_message        = (*midi_iterator).getMessage();
+				midi_message_sample = (*midi_iterator).samplePosition;
 			}
 		}
 
+		int sub_block_end = jmin(num_samples, sub_block_start + m_sub_block_size);
+		if (midi_message_remaining && midi_message_sample < sub_block_end) {
+			sub_block_end = midi_message_sample;
+		}
+
 		//============================================================
-		//======================= SMOOTHING ==========================
+		//====================== ARPEGGIATOR =========================
 		//============================================================
-		for (int i = 0; i < 3; ++i) {
-			m_osc_vol_smooth[i] =
-			    m_osc_vol_smooth[i] * GAIN_SMOOTHIN_FACTOR + (1.f - GAIN_SMOOTHIN_FACTOR) * m_osc_vol_control[i];
-			m_fil_gain_smooth[i] =
-			    m_fil_gain_smooth[i] * GAIN_SMOOTHIN_FACTOR + (1.f - GAIN_SMOOTHIN_FACTOR) * m_fil_gain_control[i];
-
-			m_fil_freq_smooth[i] = m_fil_freq_smooth[i] * FILTER_FREQ_SMOOTHING_FACTOR +
-			                       (1.f - FILTER_FREQ_SMOOTHING_FACTOR) * m_fil_freq_control[i];
+		if (m_arpeggiator_on) {
+			if (sub_block_start == arp_end) {
+				// the held keys only change with midi and the speed and gate modulation are read once per window,
+				// so a window is at most one sub-block and ends at the next midi message
+				const int arp_window = sub_block_end - sub_block_start;
+				arp_start       = sub_block_start;
+				arp_end         = arp_start + m_arpeggiator.process(arp_window, m_arp_events);
+				arp_event_index = 0;
+				m_step_led_active.set(m_arpeggiator.getStepActive());
+			}
+			while (arp_event_index < m_arp_events.size &&
+			       arp_start + m_arp_events.event[arp_event_index].sample <= sub_block_start) {
+				applyArpeggiatorEvent(m_arp_events.event[arp_event_index++]);
+			}
+			if (arp_event_index < m_arp_events.size) {
+				sub_block_end = jmin(sub_block_end, arp_start + m_arp_events.event[arp_event_index].sample);
+			}
+			sub_block_end = jmin(sub_block_end, arp_end);
 		}
 
-		m_pitch_bend_smooth =
-		    m_pitch_bend_smooth * PITCHBEND_SMOOTHIN_FACTOR + (1.f - PITCHBEND_SMOOTHIN_FACTOR) * (*m_pitchbend);
+		m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::MidiArp);
+		renderSubBlock(output_left + sub_block_start, output_right + sub_block_start, sub_block_end - sub_block_start);
+		sub_block_start = sub_block_end;
+	}
 
-		m_pitch_bend_smooth_and_applied = m_pitch_bend_smooth * m_pitchbend_amount;
+	m_cpu_profiler.endBlock(num_samples);
+}
 
-		m_modwheel_smooth =
-		    m_modwheel_smooth * PITCHBEND_SMOOTHIN_FACTOR + (1.f - PITCHBEND_SMOOTHIN_FACTOR) * (*m_modwheel);
+// renders p_num_samples into p_left and p_right
+void OdinAudioProcessor::renderSubBlock(float *p_left, float *p_right, int p_num_samples) {
+	jassert(p_num_samples > 0 && p_num_samples <= SUB_BLOCK_SIZE_MAX);
+
+	//============================================================
+	//====================== CONTROL PASS ========================
+	//============================================================
+
+	//============================================================
+	//======================= SMOOTHING ==========================
+	//============================================================
+	// the targets only change between sub-blocks, so the smoothers fill their blocks up front. Once they reached
+	// their target that is just a copy of the value
+	for (int i = 0; i < 3; ++i) {
+		m_osc_vol_smooth[i].setTarget(m_osc_vol_control[i]);
+		m_fil_gain_smooth[i].setTarget(m_fil_gain_control[i]);
+		m_fil_freq_smooth[i].setTarget(m_fil_freq_control[i]);
+		m_osc_vol_smooth[i].fill(m_osc_vol_block[i], p_num_samples);
+		m_fil_gain_smooth[i].fill(m_fil_gain_block[i], p_num_samples);
+		m_fil_freq_smooth[i].fill(m_fil_freq_block[i], p_num_samples);
+	}
 
-		m_x_smooth = m_x_smooth * PAD_SMOOTHIN_FACTOR + (1.f - PAD_SMOOTHIN_FACTOR) * (*m_xy_x);
-		m_y_smooth = m_y_smooth * PAD_SMOOTHIN_FACTOR + (1.f - PAD_SMOOTHIN_FACTOR) * (*m_xy_y);
+	float x_smooth_block[SUB_BLOCK_SIZE_MAX];
+	float y_smooth_block[SUB_BLOCK_SIZE_MAX];
+	m_pitch_bend_smooth.setTarget(*m_pitchbend);
+	m_modwheel_smooth.setTarget(*m_modwheel);
+	m_x_smooth.setTarget(*m_xy_x);
+	m_y_smooth.setTarget(*m_xy_y);
+	m_master_smooth.setTarget(m_master_control);
+	m_pitch_bend_smooth.fill(m_pitch_bend_block, p_num_samples);
+	m_modwheel_smooth.fill(m_modwheel_block, p_num_samples);
+	m_x_smooth.fill(x_smooth_block, p_num_samples);
+	m_y_smooth.fill(y_smooth_block, p_num_samples);
+	m_master_smooth.fill(m_master_block, p_num_samples);
+
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		const float pitch_bend = m_pitch_bend_block[sample];
+		const float modwheel   = m_modwheel_block[sample];
+		const float x_smooth   = x_smooth_block[sample];
+		const float y_smooth   = y_smooth_block[sample];
+
+		m_pitch_bend_smooth_and_applied = pitch_bend * m_pitchbend_amount;
 
 		if (*m_x_mod) {
-			m_x_modded = m_x_smooth + *m_x_mod;
+			m_x_modded = x_smooth + *m_x_mod;
 			m_x_modded = m_x_modded > 1.f ? 1.f : m_x_modded;
 			m_x_modded = m_x_modded < 0.f ? 0.f : m_x_modded;
 		} else {
-			m_x_modded = m_x_smooth;
+			m_x_modded = x_smooth;
 		}
 		if (*m_y_mod) {
-			m_y_modded = m_y_smooth + *m_y_mod;
+			m_y_modded = y_smooth + *m_y_mod;
 			m_y_modded = m_y_modded > 1.f ? 1.f : m_y_modded;
 			m_y_modded = m_y_modded < 0.f ? 0.f : m_y_modded;
 		} else {
-			m_y_modded = m_y_smooth;
+			m_y_modded = y_smooth;
 		}
 
-		m_master_smooth = m_master_smooth * GAIN_SMOOTHIN_FACTOR + (1 - GAIN_SMOOTHIN_FACTOR) * (m_master_control);
-
-		//============================================================
-		//========================== MIDI ============================
-		//============================================================
-		while (midi_message_remaining && midi_message_sample <= sample) {
-			handleMidiMessage(midi_message);
-			// get next midi message
-			midi_iterator++;
-			midi_message_remaining = (midi_iterator != midiMessages.end());
-			if (midi_message_remaining) {
-				midi_message        = (*midi_iterator).getMessage();
-				midi_message_sample = (*midi_iterator).samplePosition;
-			}
-		}
+		m_pitch_bend_applied_block[sample] = m_pitch_bend_smooth_and_applied;
+		m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::Smoothing);
 
 		//============================================================
 		//======================= MODMATRIX ==========================
 		//============================================================
 
-		m_mod_matrix.zeroAllDestinations();
-		m_mod_matrix.applyModulation();
-
-		//============================================================
-		//======================== VOICES ============================
-		//============================================================
+		// remember the mono sources the matrix sees for this sample, the voices apply their slots later on
+		m_global_env_block[sample] = m_global_env_mod_source;
+		m_global_lfo_block[sample] = m_global_lfo_mod_source;
+		m_x_modded_block[sample]   = m_x_modded;
+		m_y_modded_block[sample]   = m_y_modded;
+
+		// mono slots read the mono sources through the most recent voice
+		VoiceMonoInputs &mono_inputs = m_voice_mono_inputs[m_mod_matrix.getMostRecentVoice()];
+		mono_inputs.global_env       = m_global_env_mod_source;
+		mono_inputs.global_lfo       = m_global_lfo_mod_source;
+		mono_inputs.pitchwheel       = pitch_bend;
+		mono_inputs.modwheel         = modwheel;
+		mono_inputs.x                = m_x_modded;
+		mono_inputs.y                = m_y_modded;
+
+		if (m_control_rate == 1) {
+			m_mod_matrix.zeroMonoDestinations();
+			m_mod_matrix.applyModulationMono();
+		} else {
+			// slowly changing rows run at control rate and are ramped, rows with audio rate sources on top of that
+			if (m_mono_control_counter == 0) {
+				m_mod_matrix.zeroMonoDestinations();
+				m_mod_matrix.applyModulationMono(false);
+				m_mono_dest_ramp.setTarget(m_mod_destinations,
+				                           m_mod_matrix.getMonoDestinationOffsets(),
+				                           m_mod_matrix.getNumMonoDestinationOffsets(),
+				                           m_control_rate);
+			}
+			m_mono_control_counter = (m_mono_control_counter + 1) % m_control_rate;
+			m_mono_dest_ramp.next(m_mod_destinations);
+			m_mod_matrix.applyModulationMono(true);
+		}
+		m_mono_destinations_block[sample] = m_mod_destinations;
+		m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::ModMatrix);
 
 		// global lfo and envelope
 		if (m_render_ADSR[1]) {
@@ -137,236 +255,560 @@ void OdinAudioProcessor::processBlock(AudioBuffer<float> &buffer, MidiBuffer &mi
 			m_global_lfo.update();
 			m_global_lfo_mod_source = m_global_lfo.doOscillate();
 		}
+		m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::Modulators);
+	}
 
-		float stereo_signal[2] = {0};
+	//============================================================
+	//======================== VOICES ============================
+	//============================================================
+
+	// oversampled voices render into their own buffers, which are decimated into the output afterwards
+	const int num_voice_samples = p_num_samples * m_voice_oversampling;
+	float *voice_left           = m_voice_oversampling > 1 ? m_voice_output[0] : p_left;
+	float *voice_right          = m_voice_oversampling > 1 ? m_voice_output[1] : p_right;
+	memset(voice_left, 0, sizeof(float) * num_voice_samples);
+	memset(voice_right, 0, sizeof(float) * num_voice_samples);
+
+	// filter 3 follows the filter envelope of the newest voice, which keeps its last value if it is not playing
+	const float filter3_env = m_adsr[m_voice_manager.getNewestVoiceIndex()][1];
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		m_filter3_env_block[sample] = filter3_env;
+	}
 
-		// output var for the individual oscs and filters - these are modulation sources as well
-		memset(m_osc_output, 0, sizeof(float) * VOICES * 3);
-		memset(m_filter_output, 0, sizeof(float) * VOICES * 2);
+	// the active voice list can't be changed while the voices render, since voices ending on helper threads would race
+	// for it. So the voices work on a copy and ended voices are removed afterwards
+	m_render_num_active_voices = m_voice_manager.getNumActiveVoices();
+	memcpy(m_render_active_voices, m_voice_manager.getActiveVoices(), sizeof(int) * m_render_num_active_voices);
+
+	const int num_threads = m_voice_render_pool.getNumHelperThreads() + 1;
+	if (m_render_num_active_voices > 1 && num_threads > 1) {
+		// lane groups only as far as there are enough voices left to keep all threads busy
+		m_render_voices_per_job = jlimit(1, VOICE_LANES, m_render_num_active_voices / num_threads);
+		int jobs[VOICES];
+		int num_jobs = 0;
+		for (int first_voice = 0; first_voice < m_render_num_active_voices; first_voice += m_render_voices_per_job) {
+			jobs[num_jobs++] = first_voice;
+		}
 
-		// loop over all voices
-		for (int voice = 0; voice < VOICES; ++voice) {
-			if (m_voice[voice]) {
+		// all buffers are cleared and summed, a thread which is just being stopped might still deliver a voice
+		for (int thread = 0; thread < VOICE_RENDER_THREADS_MAX; ++thread) {
+			memset(m_thread_output[thread][0], 0, sizeof(float) * num_voice_samples);
+			memset(m_thread_output[thread][1], 0, sizeof(float) * num_voice_samples);
+		}
+		m_render_num_samples = p_num_samples;
+		m_voice_render_pool.run(jobs, num_jobs);
+		for (int thread = 0; thread < VOICE_RENDER_THREADS_MAX; ++thread) {
+			for (int sample = 0; sample < num_voice_samples; ++sample) {
+				voice_left[sample] += m_thread_output[thread][0][sample];
+				voice_right[sample] += m_thread_output[thread][1][sample];
+			}
+		}
+	} else {
+		for (int first_voice = 0; first_voice < m_render_num_active_voices; first_voice += VOICE_LANES) {
+			renderVoiceGroup(m_render_active_voices + first_voice,
+			                 jmin(VOICE_LANES, m_render_num_active_voices - first_voice),
+			                 voice_left,
+			                 voice_right,
+			                 p_num_samples);
+		}
+	}
 
-				for (int mod = 0; mod < 3; ++mod) {
-					//===== ADSR ======
-					if (mod < 2 || m_render_ADSR[mod - 2]) {
-						m_adsr[voice][mod] = m_voice[voice].env[mod].doEnvelope();
-					}
+	for (int active = m_voice_manager.getNumActiveVoices() - 1; active >= 0; --active) {
+		const int voice = m_voice_manager.getActiveVoices()[active];
+		if (!m_voice[voice]) {
+			// output var for the individual oscs and filters - these are modulation sources as well
+			memset(m_osc_output[voice], 0, sizeof(float) * 3);
+			memset(m_filter_output[voice], 0, sizeof(float) * 2);
+			m_voice_manager.removeActiveVoiceAt(active);
+			m_voice_manager.freeVoice(voice);
+		}
+	}
+	// the voices were booked to their own lanes, the audio thread only waited for the helpers in the meantime
+	m_cpu_profiler.start(PROFILER_MONO_LANE);
 
-					//====== LFO ======
-					if (m_render_LFO[mod]) {
-						// DBG("RENDER LFO " + std::to_string(mod));
-						m_voice[voice].lfo[mod].update();
-						m_lfo[voice][mod] = m_voice[voice].lfo[mod].doOscillate();
-					}
+	if (m_voice_oversampling > 1) {
+		m_voice_decimator.process(voice_left, voice_right, p_left, p_right, p_num_samples);
+		m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::Oversampling);
+	}
+
+	//============================================================
+	//===================== FILTER 3 & FX ========================
+	//============================================================
+
+	// without voices the input is silent, so once the tail is over there is nothing left to render
+	const bool fx_idle = m_render_num_active_voices == 0 && m_silent_samples > m_fx_tail_samples;
+	if (!fx_idle) {
+		renderFilter3(p_left, p_right, p_num_samples);
+		m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::Filter3);
+		renderFX(p_left, p_right, p_num_samples);
+	}
+
+	// the tail only counts while the output is silent, so self oscillating filters or loud repeats keep it running
+	bool silent = m_render_num_active_voices == 0;
+	for (int sample = 0; sample < p_num_samples && silent; ++sample) {
+		silent = fabs(p_left[sample]) < FX_TAIL_THRESHOLD && fabs(p_right[sample]) < FX_TAIL_THRESHOLD;
+	}
+	m_silent_samples = silent ? jmin(m_silent_samples + p_num_samples, m_fx_tail_samples + 1) : 0;
+
+	//===== OUTPUT ======
+
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		m_mod_destinations.misc.master = m_mono_destinations_block[sample].misc.master;
+
+		// apply volume & modulation
+		float master_vol_modded = m_master_block[sample];
+		if (*m_master_mod) {
+			if (*m_master_mod < 0.f) {
+				//negative modulation just modulates down to -inf dB
+				master_vol_modded = m_master_block[sample] * (1.f + *m_master_mod);
+				master_vol_modded = master_vol_modded < 0 ? 0 : master_vol_modded;
+			} else {
+				if (m_master_block[sample] > MINUS_12_dB_GAIN) {
+					// volume level above -12dB, modulate to plus 12 dB
+					master_vol_modded *= pow(PLUS_12_dB_GAIN, *m_master_mod);
+					master_vol_modded = master_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : master_vol_modded;
+				} else {
+					// if volume level is below -12dB then just modulate up to 0dB
+					master_vol_modded += (1.f - master_vol_modded) * *m_master_mod;
+					master_vol_modded = master_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : master_vol_modded;
 				}
+			}
+		}
 
-				//===== OSCS ======
-
-				for (int osc = 0; osc < 3; ++osc) {
-
-					switch (m_osc_type[osc]) {
-					case OSC_TYPE_ANALOG:
-						m_voice[voice].analog_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].analog_osc[osc].doOscillateWithSync();
-						break;
-					case OSC_TYPE_WAVETABLE:
-						m_voice[voice].wavetable_osc[osc].update();
-						//set modulation envelope/lfo
-						m_voice[voice].wavetable_osc[osc].setPosModValue(
-						    m_osc_wavetable_source_lfo[osc] ? m_lfo[voice][0] : m_adsr[voice][2]);
-						m_osc_output[voice][osc] += m_voice[voice].wavetable_osc[osc].doOscillateWithSync();
-						break;
-					case OSC_TYPE_MULTI:
-						m_voice[voice].multi_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].multi_osc[osc].doOscillate();
-						break;
-					case OSC_TYPE_VECTOR:
-						m_voice[voice].vector_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].vector_osc[osc].doOscillateWithSync();
-						break;
-					case OSC_TYPE_CHIPTUNE:
-						m_voice[voice].chiptune_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].chiptune_osc[osc].doOscillateWithSync();
-						break;
-					case OSC_TYPE_FM:
-						m_voice[voice].fm_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].fm_osc[osc].doOscillate();
-						break;
-					case OSC_TYPE_PM:
-						m_voice[voice].pm_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].pm_osc[osc].doOscillate();
-						break;
-					case OSC_TYPE_NOISE:
-						m_osc_output[voice][osc] += m_voice[voice].noise_osc[osc].doNoise();
-						break;
-					case OSC_TYPE_WAVEDRAW:
-						m_voice[voice].wavedraw_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].wavedraw_osc[osc].doOscillateWithSync();
-						break;
-					case OSC_TYPE_CHIPDRAW:
-						m_voice[voice].chipdraw_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].chipdraw_osc[osc].doOscillateWithSync();
-						break;
-					case OSC_TYPE_SPECDRAW:
-						m_voice[voice].specdraw_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].specdraw_osc[osc].doOscillateWithSync();
-						break;
-					default:
-						break;
-					}
+		p_left[sample] *= master_vol_modded;
+		p_right[sample] *= master_vol_modded;
+	}
+	m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::Output);
+}
 
-					// apply volume & modulation
-					float osc_vol_modded = m_osc_vol_smooth[osc];
-					if (*m_osc_vol_mod[voice][osc]) {
-						if (*m_osc_vol_mod[voice][osc] < 0.f) {
-							//negative modulation just modulates down to -inf dB
-							osc_vol_modded = m_osc_vol_smooth[osc] * (1.f + *m_osc_vol_mod[voice][osc]);
-							osc_vol_modded = osc_vol_modded < 0 ? 0 : osc_vol_modded;
-						} else {
-							if (m_osc_vol_smooth[osc] > MINUS_12_dB_GAIN) {
-								// volume level above -12dB, modulate to plus 12 dB
-								osc_vol_modded *= pow(PLUS_12_dB_GAIN, *m_osc_vol_mod[voice][osc]);
-								osc_vol_modded = osc_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : osc_vol_modded;
-							} else {
-								// if volume level is below -12dB then just modulate up to 0dB
-								osc_vol_modded += (1.f - osc_vol_modded) * *m_osc_vol_mod[voice][osc];
-								osc_vol_modded = osc_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : osc_vol_modded;
-							}
-						}
-					}
-					m_osc_output[voice][osc] *= osc_vol_modded;
-				} // osc loop
+static bool isLadderFilterType(int p_filter_type) {
+	switch (p_filter_type) {
+	case FILTER_TYPE_LP24:
+	case FILTER_TYPE_LP12:
+	case FILTER_TYPE_BP24:
+	case FILTER_TYPE_BP12:
+	case FILTER_TYPE_HP24:
+	case FILTER_TYPE_HP12:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// p_num_samples are host samples, the voices write m_voice_oversampling times as many to p_left and p_right
+void OdinAudioProcessor::renderVoiceGroup(const int *p_voices, int p_num_voices, float *p_left, float *p_right, int p_num_samples) {
+	if (p_num_voices > 1 && (isLadderFilterType(m_fil_type[0]) || isLadderFilterType(m_fil_type[1]))) {
+		renderVoiceLanes(p_voices, p_num_voices, p_left, p_right, p_num_samples);
+		return;
+	}
+	for (int voice = 0; voice < p_num_voices; ++voice) {
+		renderVoice(p_voices[voice], p_left, p_right, p_num_samples);
+	}
+}
+
+void OdinAudioProcessor::renderVoice(int p_voice, float *p_left, float *p_right, int p_num_samples) {
+	const bool is_newest_voice  = p_voice == m_voice_manager.getNewestVoiceIndex();
+	const int num_voice_samples = p_num_samples * m_voice_oversampling;
+
+	for (int voice_sample = 0; voice_sample < num_voice_samples; ++voice_sample) {
+		// the controls of a host sample are held for all oversampling steps of it
+		const int sample = voice_sample / m_voice_oversampling;
+
+		// the amp envelope might have ended the voice
+		if (!m_voice[p_voice]) {
+			break;
+		}
+
+		renderVoiceSources(p_voice, sample);
+
+		float filter_input[2] = {0};
+		for (int fil = 0; fil < 2; ++fil) {
+			// fil1->fil2 is done at the end of fil1 calc
+			addVoiceFilterInput(p_voice, fil, filter_input[fil]);
+			m_filter_output[p_voice][fil] = renderVoiceFilter(p_voice, fil, filter_input[fil], sample);
+			applyVoiceFilterGain(p_voice, fil, sample);
+			m_cpu_profiler.lap(p_voice, CpuProfiler::getFilterSection(m_fil_type[fil]));
+
+			// add first filter to second filter input
+			if (fil == 0 && *m_fil2_fil1) {
+				filter_input[1] += m_filter_output[p_voice][0];
+			}
+		}
+
+		renderVoiceOutput(p_voice, sample, voice_sample, is_newest_voice, p_left, p_right);
+		m_cpu_profiler.lap(p_voice, CpuProfiler::AmpDistortion);
+	}
+}
 
-				//===== FILTERS ======
+void OdinAudioProcessor::renderVoiceLanes(const int *p_voices, int p_num_voices, float *p_left, float *p_right, int p_num_samples) {
+	jassert(p_num_voices <= VOICE_LANES);
 
-				float filter_input[2] = {0};
-				m_voice[voice].setFilterEnvValue(m_adsr[voice][1]); // can be split up to individual filters
+	// the voices run in lockstep, so the ladder filters of all of them can be computed side by side
+	const int newest_voice  = m_voice_manager.getNewestVoiceIndex();
+	const bool use_lanes[2] = {isLadderFilterType(m_fil_type[0]), isLadderFilterType(m_fil_type[1])};
+	bool lane_playing[VOICE_LANES];
+	LadderFilterLanes ladder_lanes[2];
+
+	for (int fil = 0; fil < 2; ++fil) {
+		if (use_lanes[fil]) {
+			LadderFilter *filters[VOICE_LANES];
+			for (int lane = 0; lane < VOICE_LANES; ++lane) {
+				filters[lane] = lane < p_num_voices ? &m_voice[p_voices[lane]].ladder_filter[fil] : nullptr;
+			}
+			ladder_lanes[fil].load(filters);
+		}
+	}
+	for (int lane = 0; lane < VOICE_LANES; ++lane) {
+		lane_playing[lane] = lane < p_num_voices;
+	}
+
+	alignas(32) double lane_input[VOICE_LANES];
+	alignas(32) double lane_output[VOICE_LANES];
+
+	const int num_voice_samples = p_num_samples * m_voice_oversampling;
+	for (int voice_sample = 0; voice_sample < num_voice_samples; ++voice_sample) {
+		const int sample = voice_sample / m_voice_oversampling;
+
+		// a voice which was ended by its amp envelope hands back its filter state and drops out
+		int num_playing = 0;
+		for (int lane = 0; lane < p_num_voices; ++lane) {
+			if (lane_playing[lane] && !m_voice[p_voices[lane]]) {
+				lane_playing[lane] = false;
 				for (int fil = 0; fil < 2; ++fil) {
-					// get filter inputs, fil1->fil2 is done at the end of fil1 calc
-					if (*m_fil_osc1[fil]) {
-						filter_input[fil] += m_osc_output[voice][0];
-					}
-					if (*m_fil_osc2[fil]) {
-						filter_input[fil] += m_osc_output[voice][1];
+					if (use_lanes[fil]) {
+						ladder_lanes[fil].store(lane);
 					}
-					if (*m_fil_osc3[fil]) {
-						filter_input[fil] += m_osc_output[voice][2];
+				}
+			}
+			num_playing += lane_playing[lane] ? 1 : 0;
+		}
+		if (num_playing == 0) {
+			break;
+		}
+
+		for (int lane = 0; lane < p_num_voices; ++lane) {
+			if (lane_playing[lane]) {
+				renderVoiceSources(p_voices[lane], sample);
+			}
+		}
+		// the filters and outputs of the group are computed together, they are booked to the lane of its first voice
+		m_cpu_profiler.start(p_voices[0]);
+
+		float filter_input[VOICE_LANES][2] = {{0}};
+		for (int fil = 0; fil < 2; ++fil) {
+			if (use_lanes[fil]) {
+				for (int lane = 0; lane < VOICE_LANES; ++lane) {
+					lane_input[lane] = 0.0;
+					if (lane_playing[lane]) {
+						LadderFilter &filter = m_voice[p_voices[lane]].ladder_filter[fil];
+						addVoiceFilterInput(p_voices[lane], fil, filter_input[lane][fil]);
+						filter.m_freq_base = m_fil_freq_block[fil][sample];
+						filter.update();
+						ladder_lanes[fil].syncCoefficients(lane);
+						lane_input[lane] = filter_input[lane][fil];
 					}
-					switch (m_fil_type[fil]) {
-					case FILTER_TYPE_NONE:
-					default:
-						m_filter_output[voice][fil] = filter_input[fil];
-						break;
-					case FILTER_TYPE_LP24:
-					case FILTER_TYPE_LP12:
-					case FILTER_TYPE_BP24:
-					case FILTER_TYPE_BP12:
-					case FILTER_TYPE_HP24:
-					case FILTER_TYPE_HP12:
-						m_voice[voice].ladder_filter[fil].m_freq_base = m_fil_freq_smooth[fil];
-						m_voice[voice].ladder_filter[fil].update();
-						m_filter_output[voice][fil] = m_voice[voice].ladder_filter[fil].doFilter(filter_input[fil]);
-						break;
-					case FILTER_TYPE_SEM12:
-						m_voice[voice].SEM_filter_12[fil].m_freq_base = m_fil_freq_smooth[fil];
-						m_voice[voice].SEM_filter_12[fil].update();
-						m_filter_output[voice][fil] = m_voice[voice].SEM_filter_12[fil].doFilter(filter_input[fil]);
-						break;
-					case FILTER_TYPE_KORG_LP:
-					case FILTER_TYPE_KORG_HP:
-						m_voice[voice].korg_filter[fil].m_freq_base = m_fil_freq_smooth[fil];
-						m_voice[voice].korg_filter[fil].update();
-						m_filter_output[voice][fil] = m_voice[voice].korg_filter[fil].doFilter(filter_input[fil]);
-						break;
-					case FILTER_TYPE_DIODE:
-						m_voice[voice].diode_filter[fil].m_freq_base = m_fil_freq_smooth[fil];
-						m_voice[voice].diode_filter[fil].update();
-						m_filter_output[voice][fil] = m_voice[voice].diode_filter[fil].doFilter(filter_input[fil]);
-						break;
-					case FILTER_TYPE_FORMANT:
-						m_voice[voice].formant_filter[fil].m_freq_base = m_fil_freq_smooth[fil];
-						m_voice[voice].formant_filter[fil].update();
-						m_filter_output[voice][fil] = m_voice[voice].formant_filter[fil].doFilter(filter_input[fil]);
-						break;
-					case FILTER_TYPE_COMB:
-						m_voice[voice].comb_filter[fil].setCombFreq(m_fil_freq_smooth[fil]);
-						m_filter_output[voice][fil] = m_voice[voice].comb_filter[fil].doFilter(filter_input[fil]);
-						break;
-					case FILTER_TYPE_RINGMOD:
-						m_voice[voice].ring_mod[fil].setBaseFrequency(m_fil_freq_smooth[fil]);
-						m_voice[voice].ring_mod[fil].setGlideTargetFrequency(m_fil_freq_smooth[fil]);
-						m_voice[voice].ring_mod[fil].update();
-						m_filter_output[voice][fil] = m_voice[voice].ring_mod[fil].doRingModulator(filter_input[fil]);
-						break;
+				}
+				ladder_lanes[fil].doFilter(lane_input, lane_output);
+				for (int lane = 0; lane < p_num_voices; ++lane) {
+					if (lane_playing[lane]) {
+						m_voice[p_voices[lane]].ladder_filter[fil].applyOverdrive(lane_output[lane]);
+						m_filter_output[p_voices[lane]][fil] = lane_output[lane];
 					}
-
-					//apply gain & -modulation
-					if (m_fil_type[fil] != FILTER_TYPE_NONE) {
-						// apply volume & modulation
-						float fil_vol_modded = m_fil_gain_smooth[fil];
-						if (*m_fil_12_vol_mod[voice][fil]) {
-							if (*m_fil_12_vol_mod[voice][fil] < 0.f) {
-								//negative modulation just modulates down to -inf dB
-								fil_vol_modded = m_fil_gain_smooth[fil] * (1.f + *m_fil_12_vol_mod[voice][fil]);
-								fil_vol_modded = fil_vol_modded < 0 ? 0 : fil_vol_modded;
-							} else {
-								if (m_fil_gain_smooth[fil] > MINUS_12_dB_GAIN) {
-									// volume level above -12dB, modulate to plus 12 dB
-									fil_vol_modded *= pow(PLUS_12_dB_GAIN, *m_fil_12_vol_mod[voice][fil]);
-									fil_vol_modded =
-									    fil_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : fil_vol_modded;
-								} else {
-									// if volume level is below -12dB then just modulate up to 0dB
-									fil_vol_modded += (1.f - fil_vol_modded) * *m_fil_12_vol_mod[voice][fil];
-									fil_vol_modded =
-									    fil_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : fil_vol_modded;
-								}
-							}
-						}
-						m_filter_output[voice][fil] *= fil_vol_modded;
+				}
+			} else {
+				for (int lane = 0; lane < p_num_voices; ++lane) {
+					if (lane_playing[lane]) {
+						addVoiceFilterInput(p_voices[lane], fil, filter_input[lane][fil]);
+						m_filter_output[p_voices[lane]][fil] =
+						    renderVoiceFilter(p_voices[lane], fil, filter_input[lane][fil], sample);
 					}
+				}
+			}
 
+			for (int lane = 0; lane < p_num_voices; ++lane) {
+				if (lane_playing[lane]) {
+					applyVoiceFilterGain(p_voices[lane], fil, sample);
 					// add first filter to second filter input
 					if (fil == 0 && *m_fil2_fil1) {
-						filter_input[1] += m_filter_output[voice][0];
+						filter_input[lane][1] += m_filter_output[p_voices[lane]][0];
 					}
-				} // filter loop
+				}
+			}
+			m_cpu_profiler.lap(p_voices[0], CpuProfiler::getFilterSection(m_fil_type[fil]));
+		}
 
-				float voices_output = 0;
+		for (int lane = 0; lane < p_num_voices; ++lane) {
+			if (lane_playing[lane]) {
+				renderVoiceOutput(
+				    p_voices[lane], sample, voice_sample, p_voices[lane] == newest_voice, p_left, p_right);
+			}
+		}
+		m_cpu_profiler.lap(p_voices[0], CpuProfiler::AmpDistortion);
+	}
 
-				if (*m_fil1_to_amp) {
-					voices_output += m_filter_output[voice][0];
+	for (int lane = 0; lane < p_num_voices; ++lane) {
+		if (lane_playing[lane]) {
+			for (int fil = 0; fil < 2; ++fil) {
+				if (use_lanes[fil]) {
+					ladder_lanes[fil].store(lane);
 				}
-				if (*m_fil2_to_amp) {
-					voices_output += m_filter_output[voice][1];
+			}
+		}
+	}
+}
+
+void OdinAudioProcessor::renderVoiceSources(int p_voice, int p_sample) {
+	// mono sources and destinations as they were when the control pass ran the matrix for this sample
+	VoiceMonoInputs &mono_inputs   = m_voice_mono_inputs[p_voice];
+	mono_inputs.global_env         = m_global_env_block[p_sample];
+	mono_inputs.global_lfo         = m_global_lfo_block[p_sample];
+	mono_inputs.pitchwheel         = m_pitch_bend_block[p_sample];
+	mono_inputs.pitch_bend_applied = m_pitch_bend_applied_block[p_sample];
+	mono_inputs.modwheel           = m_modwheel_block[p_sample];
+	mono_inputs.x                  = m_x_modded_block[p_sample];
+	mono_inputs.y                  = m_y_modded_block[p_sample];
+	mono_inputs.glide              = m_mono_destinations_block[p_sample].misc.glide;
+	m_cpu_profiler.start(p_voice);
+
+	if (m_control_rate == 1) {
+		m_mod_matrix.zeroVoiceDestinations(p_voice);
+		m_mod_matrix.applyModulationVoice(p_voice);
+	} else {
+		// slowly changing rows run at control rate and are ramped, rows with audio rate sources on top of that
+		if (m_voice_control_counter[p_voice] == 0) {
+			m_mod_matrix.zeroVoiceDestinations(p_voice);
+			m_mod_matrix.applyModulationVoice(p_voice, false);
+			m_voice_dest_ramp[p_voice].setTarget(m_mod_destinations.voice[p_voice],
+			                                     m_mod_matrix.getVoiceDestinationOffsets(),
+			                                     m_mod_matrix.getNumVoiceDestinationOffsets(),
+			                                     m_control_rate);
+		}
+		m_voice_control_counter[p_voice] = (m_voice_control_counter[p_voice] + 1) % m_control_rate;
+		m_voice_dest_ramp[p_voice].next(m_mod_destinations.voice[p_voice]);
+		m_mod_matrix.applyModulationVoice(p_voice, true);
+	}
+	m_cpu_profiler.lap(p_voice, CpuProfiler::ModMatrix);
+
+	memset(m_osc_output[p_voice], 0, sizeof(float) * 3);
+
+	for (int mod = 0; mod < 3; ++mod) {
+		//===== ADSR ======
+		if (mod < 2 || m_render_ADSR[mod - 2]) {
+			m_adsr[p_voice][mod] = m_voice[p_voice].env[mod].doEnvelope();
+		}
+
+		//====== LFO ======
+		if (m_render_LFO[mod]) {
+			// DBG("RENDER LFO " + std::to_string(mod));
+			m_voice[p_voice].lfo[mod].update();
+			m_lfo[p_voice][mod] = m_voice[p_voice].lfo[mod].doOscillate();
+		}
+	}
+	m_cpu_profiler.lap(p_voice, CpuProfiler::Modulators);
+
+	//===== OSCS ======
+
+	for (int osc = 0; osc < 3; ++osc) {
+
+		switch (m_osc_type[osc]) {
+		case OSC_TYPE_ANALOG:
+			m_voice[p_voice].analog_osc[osc].update();
+			m_osc_output[p_voice][osc] += m_voice[p_voice].analog_osc[osc].doOscillateWithSync();
+			break;
+		case OSC_TYPE_WAVETABLE:
+			m_voice[p_voice].wavetable_osc[osc].update();
+			//set modulation envelope/lfo
+			m_voice[p_voice].wavetable_osc[osc].setPosModValue(
+			    m_osc_wavetable_source_lfo[osc] ? m_lfo[p_voice][0] : m_adsr[p_voice][2]);
+			m_osc_output[p_voice][osc] += m_voice[p_voice].wavetable_osc[osc].doOscillateWithSync();
+			break;
+		case OSC_TYPE_MULTI:
+			m_voice[p_voice].multi_osc[osc].update();
+			m_osc_output[p_voice][osc] += m_voice[p_voice].multi_osc[osc].doOscillate();
+			break;
+		case OSC_TYPE_VECTOR:
+			m_voice[p_voice].vector_osc[osc].update();
+			m_osc_output[p_voice][osc] += m_voice[p_voice].vector_osc[osc].doOscillateWithSync();
+			break;
+		case OSC_TYPE_CHIPTUNE:
+			m_voice[p_voice].chiptune_osc[osc].update();
+			m_osc_output[p_voice][osc] += m_voice[p_voice].chiptune_osc[osc].doOscillateWithSync();
+			break;
+		case OSC_TYPE_FM:
+			m_voice[p_voice].fm_osc[osc].update();
+			m_osc_output[p_voice][osc] += m_voice[p_voice].fm_osc[osc].doOscillate();
+			break;
+		case OSC_TYPE_PM:
+			m_voice[p_voice].pm_osc[osc].update();
+			m_osc_output[p_voice][osc] += m_voice[p_voice].pm_osc[osc].doOscillate();
+			break;
+		case OSC_TYPE_NOISE:
+			m_osc_output[p_voice][osc] += m_voice[p_voice].noise_osc[osc].doNoise();
+			break;
+		case OSC_TYPE_WAVEDRAW:
+			m_voice[p_voice].wavedraw_osc[osc].update();
+			m_osc_output[p_voice][osc] += m_voice[p_voice].wavedraw_osc[osc].doOscillateWithSync();
+			break;
+		case OSC_TYPE_CHIPDRAW:
+			m_voice[p_voice].chipdraw_osc[osc].update();
+			m_osc_output[p_voice][osc] += m_voice[p_voice].chipdraw_osc[osc].doOscillateWithSync();
+			break;
+		case OSC_TYPE_SPECDRAW:
+			m_voice[p_voice].specdraw_osc[osc].update();
+			m_osc_output[p_voice][osc] += m_voice[p_voice].specdraw_osc[osc].doOscillateWithSync();
+			break;
+		default:
+			break;
+		}
+
+		// apply volume & modulation
+		float osc_vol_modded = m_osc_vol_block[osc][p_sample];
+		if (*m_osc_vol_mod[p_voice][osc]) {
+			if (*m_osc_vol_mod[p_voice][osc] < 0.f) {
+				//negative modulation just modulates down to -inf dB
+				osc_vol_modded = m_osc_vol_block[osc][p_sample] * (1.f + *m_osc_vol_mod[p_voice][osc]);
+				osc_vol_modded = osc_vol_modded < 0 ? 0 : osc_vol_modded;
+			} else {
+				if (m_osc_vol_block[osc][p_sample] > MINUS_12_dB_GAIN) {
+					// volume level above -12dB, modulate to plus 12 dB
+					osc_vol_modded *= pow(PLUS_12_dB_GAIN, *m_osc_vol_mod[p_voice][osc]);
+					osc_vol_modded = osc_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : osc_vol_modded;
+				} else {
+					// if volume level is below -12dB then just modulate up to 0dB
+					osc_vol_modded += (1.f - osc_vol_modded) * *m_osc_vol_mod[p_voice][osc];
+					osc_vol_modded = osc_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : osc_vol_modded;
 				}
+			}
+		}
+		m_osc_output[p_voice][osc] *= osc_vol_modded;
+		m_cpu_profiler.lap(p_voice, CpuProfiler::getOscSection(m_osc_type[osc]));
+	} // osc loop
 
-				//SIGNAL IS POLY STEREO FROM HERE ON
-				float stereo_signal_voice[2];
+	m_voice[p_voice].setFilterEnvValue(m_adsr[p_voice][1]); // can be split up to individual filters
+}
+
+void OdinAudioProcessor::addVoiceFilterInput(int p_voice, int p_fil, float &pio_input) {
+	if (*m_fil_osc1[p_fil]) {
+		pio_input += m_osc_output[p_voice][0];
+	}
+	if (*m_fil_osc2[p_fil]) {
+		pio_input += m_osc_output[p_voice][1];
+	}
+	if (*m_fil_osc3[p_fil]) {
+		pio_input += m_osc_output[p_voice][2];
+	}
+}
 
-				//===== AMPLIFIER ======
-				m_voice[voice].amp.doAmplifier(voices_output, stereo_signal_voice[0], stereo_signal_voice[1]);
+float OdinAudioProcessor::renderVoiceFilter(int p_voice, int p_fil, float p_input, int p_sample) {
+	switch (m_fil_type[p_fil]) {
+	case FILTER_TYPE_NONE:
+	default:
+		return p_input;
+	case FILTER_TYPE_LP24:
+	case FILTER_TYPE_LP12:
+	case FILTER_TYPE_BP24:
+	case FILTER_TYPE_BP12:
+	case FILTER_TYPE_HP24:
+	case FILTER_TYPE_HP12:
+		m_voice[p_voice].ladder_filter[p_fil].m_freq_base = m_fil_freq_block[p_fil][p_sample];
+		m_voice[p_voice].ladder_filter[p_fil].update();
+		return m_voice[p_voice].ladder_filter[p_fil].doFilter(p_input);
+	case FILTER_TYPE_SEM12:
+		m_voice[p_voice].SEM_filter_12[p_fil].m_freq_base = m_fil_freq_block[p_fil][p_sample];
+		m_voice[p_voice].SEM_filter_12[p_fil].update();
+		return m_voice[p_voice].SEM_filter_12[p_fil].doFilter(p_input);
+	case FILTER_TYPE_KORG_LP:
+	case FILTER_TYPE_KORG_HP:
+		m_voice[p_voice].korg_filter[p_fil].m_freq_base = m_fil_freq_block[p_fil][p_sample];
+		m_voice[p_voice].korg_filter[p_fil].update();
+		return m_voice[p_voice].korg_filter[p_fil].doFilter(p_input);
+	case FILTER_TYPE_DIODE:
+		m_voice[p_voice].diode_filter[p_fil].m_freq_base = m_fil_freq_block[p_fil][p_sample];
+		m_voice[p_voice].diode_filter[p_fil].update();
+		return m_voice[p_voice].diode_filter[p_fil].doFilter(p_input);
+	case FILTER_TYPE_FORMANT:
+		m_voice[p_voice].formant_filter[p_fil].m_freq_base = m_fil_freq_block[p_fil][p_sample];
+		m_voice[p_voice].formant_filter[p_fil].update();
+		return m_voice[p_voice].formant_filter[p_fil].doFilter(p_input);
+	case FILTER_TYPE_COMB:
+		m_voice[p_voice].comb_filter[p_fil].setCombFreq(m_fil_freq_block[p_fil][p_sample]);
+		return m_voice[p_voice].comb_filter[p_fil].doFilter(p_input);
+	case FILTER_TYPE_RINGMOD:
+		m_voice[p_voice].ring_mod[p_fil].setBaseFrequency(m_fil_freq_block[p_fil][p_sample]);
+		m_voice[p_voice].ring_mod[p_fil].setGlideTargetFrequency(m_fil_freq_block[p_fil][p_sample]);
+		m_voice[p_voice].ring_mod[p_fil].update();
+		return m_voice[p_voice].ring_mod[p_fil].doRingModulator(p_input);
+	}
+}
 
-				//===== DISTORTION ======
-				if (m_dist_on) {
-					stereo_signal_voice[0] = m_voice[voice].distortion[0].doDistortion(stereo_signal_voice[0]);
-					stereo_signal_voice[1] = m_voice[voice].distortion[1].doDistortion(stereo_signal_voice[1]);
+void OdinAudioProcessor::applyVoiceFilterGain(int p_voice, int p_fil, int p_sample) {
+	if (m_fil_type[p_fil] != FILTER_TYPE_NONE) {
+		// apply volume & modulation
+		float fil_vol_modded = m_fil_gain_block[p_fil][p_sample];
+		if (*m_fil_12_vol_mod[p_voice][p_fil]) {
+			if (*m_fil_12_vol_mod[p_voice][p_fil] < 0.f) {
+				//negative modulation just modulates down to -inf dB
+				fil_vol_modded = m_fil_gain_block[p_fil][p_sample] * (1.f + *m_fil_12_vol_mod[p_voice][p_fil]);
+				fil_vol_modded = fil_vol_modded < 0 ? 0 : fil_vol_modded;
+			} else {
+				if (m_fil_gain_block[p_fil][p_sample] > MINUS_12_dB_GAIN) {
+					// volume level above -12dB, modulate to plus 12 dB
+					fil_vol_modded *= pow(PLUS_12_dB_GAIN, *m_fil_12_vol_mod[p_voice][p_fil]);
+					fil_vol_modded =
+					    fil_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : fil_vol_modded;
+				} else {
+					// if volume level is below -12dB then just modulate up to 0dB
+					fil_vol_modded += (1.f - fil_vol_modded) * *m_fil_12_vol_mod[p_voice][p_fil];
+					fil_vol_modded =
+					    fil_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : fil_vol_modded;
 				}
+			}
+		}
+		m_filter_output[p_voice][p_fil] *= fil_vol_modded;
+	}
+}
 
-				//apply amp envelope
-				stereo_signal[0] += stereo_signal_voice[0] * m_adsr[voice][0];
-				stereo_signal[1] += stereo_signal_voice[1] * m_adsr[voice][0];
-			} // voice active
-		}     // voice loop
+// p_sample indexes the controls of the sub-block, p_voice_sample the oversampled output
+void OdinAudioProcessor::renderVoiceOutput(
+    int p_voice, int p_sample, int p_voice_sample, bool p_is_newest_voice, float *p_left, float *p_right) {
+	float voices_output = 0;
 
-		for (int channel = 0; channel < 2; ++channel) {
+	if (*m_fil1_to_amp) {
+		voices_output += m_filter_output[p_voice][0];
+	}
+	if (*m_fil2_to_amp) {
+		voices_output += m_filter_output[p_voice][1];
+	}
 
-			//===== FILTER 3 ======
+	//SIGNAL IS POLY STEREO FROM HERE ON
+	float stereo_signal_voice[2];
 
-			setFilter3EnvValue();
+	//===== AMPLIFIER ======
+	m_voice[p_voice].amp.doAmplifier(voices_output, stereo_signal_voice[0], stereo_signal_voice[1]);
 
+	//===== DISTORTION ======
+	if (m_dist_on) {
+		stereo_signal_voice[0] = m_voice[p_voice].distortion[0].doDistortion(stereo_signal_voice[0]);
+		stereo_signal_voice[1] = m_voice[p_voice].distortion[1].doDistortion(stereo_signal_voice[1]);
+	}
+
+	//apply amp envelope
+	p_left[p_voice_sample] += stereo_signal_voice[0] * m_adsr[p_voice][0];
+	p_right[p_voice_sample] += stereo_signal_voice[1] * m_adsr[p_voice][0];
+
+	if (p_is_newest_voice) {
+		m_filter3_env_block[p_sample] = m_adsr[p_voice][1];
+	}
+}
+
+void OdinAudioProcessor::renderFilter3(float *p_left, float *p_right, int p_num_samples) {
+	float *channel_data[2] = {p_left, p_right};
+
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		m_mod_destinations.filter3 = m_mono_destinations_block[sample].filter3;
+		setFilter3EnvValue(m_filter3_env_block[sample]);
+
+		for (int channel = 0; channel < 2; ++channel) {
 			switch (m_fil_type[2]) {
 			case FILTER_TYPE_LP24:
 			case FILTER_TYPE_LP12:
@@ -374,41 +816,41 @@ void OdinAudioProcessor::processBlock(AudioBuffer<float> &buffer, MidiBuffer &mi
 			case FILTER_TYPE_BP12:
 			case FILTER_TYPE_HP24:
 			case FILTER_TYPE_HP12:
-				m_ladder_filter[channel].m_freq_base = m_fil_freq_smooth[2];
+				m_ladder_filter[channel].m_freq_base = m_fil_freq_block[2][sample];
 				m_ladder_filter[channel].update();
-				stereo_signal[channel] = m_ladder_filter[channel].doFilter(stereo_signal[channel]);
+				channel_data[channel][sample] = m_ladder_filter[channel].doFilter(channel_data[channel][sample]);
 				break;
 			case FILTER_TYPE_SEM12:
-				m_SEM_filter_12[channel].m_freq_base = m_fil_freq_smooth[2];
+				m_SEM_filter_12[channel].m_freq_base = m_fil_freq_block[2][sample];
 				m_SEM_filter_12[channel].update();
-				stereo_signal[channel] = m_SEM_filter_12[channel].doFilter(stereo_signal[channel]);
+				channel_data[channel][sample] = m_SEM_filter_12[channel].doFilter(channel_data[channel][sample]);
 				break;
 			case FILTER_TYPE_KORG_LP:
 			case FILTER_TYPE_KORG_HP:
-				m_korg_filter[channel].m_freq_base = m_fil_freq_smooth[2];
+				m_korg_filter[channel].m_freq_base = m_fil_freq_block[2][sample];
 				m_korg_filter[channel].update();
-				stereo_signal[channel] = m_korg_filter[channel].doFilter(stereo_signal[channel]);
+				channel_data[channel][sample] = m_korg_filter[channel].doFilter(channel_data[channel][sample]);
 				break;
 			case FILTER_TYPE_DIODE:
-				m_diode_filter[channel].m_freq_base = m_fil_freq_smooth[2];
+				m_diode_filter[channel].m_freq_base = m_fil_freq_block[2][sample];
 				m_diode_filter[channel].update();
-				stereo_signal[channel] = m_diode_filter[channel].doFilter(stereo_signal[channel]);
+				channel_data[channel][sample] = m_diode_filter[channel].doFilter(channel_data[channel][sample]);
 				break;
 			case FILTER_TYPE_FORMANT:
-				m_formant_filter[channel].m_freq_base = m_fil_freq_smooth[2];
+				m_formant_filter[channel].m_freq_base = m_fil_freq_block[2][sample];
 				m_formant_filter[channel].update();
-				stereo_signal[channel] = m_formant_filter[channel].doFilter(stereo_signal[channel]);
+				channel_data[channel][sample] = m_formant_filter[channel].doFilter(channel_data[channel][sample]);
 				break;
 			case FILTER_TYPE_COMB:
-				m_comb_filter[channel].setCombFreq(m_fil_freq_smooth[2]);
-				stereo_signal[channel] = m_comb_filter[channel].doFilter(stereo_signal[channel]);
+				m_comb_filter[channel].setCombFreq(m_fil_freq_block[2][sample]);
+				channel_data[channel][sample] = m_comb_filter[channel].doFilter(channel_data[channel][sample]);
 				break;
 			case FILTER_TYPE_RINGMOD:
-				m_ring_mod[channel].setBaseFrequency(m_fil_freq_smooth[2]);
-				m_ring_mod[channel].setGlideTargetFrequency(m_fil_freq_smooth[2]);
+				m_ring_mod[channel].setBaseFrequency(m_fil_freq_block[2][sample]);
+				m_ring_mod[channel].setGlideTargetFrequency(m_fil_freq_block[2][sample]);
 
 				m_ring_mod[channel].update();
-				stereo_signal[channel] = m_ring_mod[channel].doRingModulator(stereo_signal[channel]);
+				channel_data[channel][sample] = m_ring_mod[channel].doRingModulator(channel_data[channel][sample]);
 				break;
 			default:
 				break;
@@ -416,14 +858,14 @@ void OdinAudioProcessor::processBlock(AudioBuffer<float> &buffer, MidiBuffer &mi
 			//apply gain & -modulation
 			if (m_fil_type[2] != FILTER_TYPE_NONE) {
 				// apply volume & modulation
-				float fil_vol_modded = m_fil_gain_smooth[2];
+				float fil_vol_modded = m_fil_gain_block[2][sample];
 				if (*m_fil_3_vol_mod) {
 					if (*m_fil_3_vol_mod < 0.f) {
 						//negative modulation just modulates down to -inf dB
-						fil_vol_modded = m_fil_gain_smooth[2] * (1.f + *m_fil_3_vol_mod);
+						fil_vol_modded = m_fil_gain_block[2][sample] * (1.f + *m_fil_3_vol_mod);
 						fil_vol_modded = fil_vol_modded < 0 ? 0 : fil_vol_modded;
 					} else {
-						if (m_fil_gain_smooth[2] > MINUS_12_dB_GAIN) {
+						if (m_fil_gain_block[2][sample] > MINUS_12_dB_GAIN) {
 							// volume level above -12dB, modulate to plus 12 dB
 							fil_vol_modded *= pow(PLUS_12_dB_GAIN, *m_fil_3_vol_mod);
 							fil_vol_modded = fil_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : fil_vol_modded;
@@ -434,69 +876,100 @@ void OdinAudioProcessor::processBlock(AudioBuffer<float> &buffer, MidiBuffer &mi
 						}
 					}
 				}
-				stereo_signal[channel] *= fil_vol_modded;
+				channel_data[channel][sample] *= fil_vol_modded;
 			}
 		} // stereo loop
+	}
+}
 
-		//==== FX SECTION ====
+void OdinAudioProcessor::updateTailLength() {
+	float tail = FILTER3_TAIL_SECONDS;
+	if (m_fil_type[2] == FILTER_TYPE_COMB) {
+		tail = feedbackTailLength(m_comb_filter[0].m_delay_time_control,
+		                          m_comb_filter[0].m_feedback + *m_comb_filter[0].m_res_mod);
+	}
 
-		// ugly solution, yet here we go:
-		// check for each fx if its position is slot and then render it
-		// todo this section should really be solved with function pointers! This is ugly code
-		for (int fx_slot = 0; fx_slot < 5; ++fx_slot) {
-			if (m_delay_position == fx_slot) {
-				if (*m_delay_on) {
-					stereo_signal[0] = m_delay.doDelayLeft(stereo_signal[0]);
-					stereo_signal[1] = m_delay.doDelayRight(stereo_signal[1]);
-				}
-			} else if (m_phaser_position == fx_slot) {
-				if (*m_phaser_on) {
-					stereo_signal[0] = m_phaser.doPhaserLeft(stereo_signal[0]);
-					stereo_signal[1] = m_phaser.doPhaserRight(stereo_signal[1]);
+	// the fx run in series, so their tails add up
+	if (*m_delay_on) {
+		tail += m_delay.getTailLength();
+	}
+	if (*m_phaser_on) {
+		tail += m_phaser.getTailLength();
+	}
+	if (*m_flanger_on) {
+		tail += m_flanger[0].getTailLength();
+	}
+	if (*m_chorus_on) {
+		tail += m_chorus[0].getTailLength();
+	}
+	if (*m_reverb_on) {
+		tail += m_reverb_zita.get_tail_length();
+	}
+	tail = jmin(tail, FX_TAIL_MAX_SECONDS);
+
+	m_fx_tail_samples = (int)(tail * m_samplerate);
+	m_tail_length.store(tail + *m_env1_release);
+}
+
+void OdinAudioProcessor::renderFX(float *p_left, float *p_right, int p_num_samples) {
+	// ugly solution, yet here we go:
+	// check for each fx if its position is slot and then render it
+	// todo this section should really be solved with function pointers! This is ugly code
+	for (int fx_slot = 0; fx_slot < 5; ++fx_slot) {
+		if (m_delay_position == fx_slot) {
+			if (*m_delay_on) {
+				for (int sample = 0; sample < p_num_samples; ++sample) {
+					m_mod_destinations.delay = m_mono_destinations_block[sample].delay;
+					p_left[sample]           = m_delay.doDelayLeft(p_left[sample]);
+					p_right[sample]          = m_delay.doDelayRight(p_right[sample]);
 				}
-			} else if (m_flanger_position == fx_slot) {
-				if (*m_flanger_on) {
-					stereo_signal[0] = m_flanger[0].doFlanger(stereo_signal[0]);
-					stereo_signal[1] = m_flanger[1].doFlanger(stereo_signal[1]);
+				m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::Delay);
+			}
+		} else if (m_phaser_position == fx_slot) {
+			if (*m_phaser_on) {
+				for (int sample = 0; sample < p_num_samples; ++sample) {
+					m_mod_destinations.phaser = m_mono_destinations_block[sample].phaser;
+					p_left[sample]            = m_phaser.doPhaserLeft(p_left[sample]);
+					p_right[sample]           = m_phaser.doPhaserRight(p_right[sample]);
 				}
-			} else if (m_chorus_position == fx_slot) {
-				if (*m_chorus_on) {
-					stereo_signal[0] = m_chorus[0].doChorus(stereo_signal[0]);
-					stereo_signal[1] = m_chorus[1].doChorus(stereo_signal[1]);
+				m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::Phaser);
+			}
+		} else if (m_flanger_position == fx_slot) {
+			if (*m_flanger_on) {
+				for (int sample = 0; sample < p_num_samples; ++sample) {
+					m_mod_destinations.flanger = m_mono_destinations_block[sample].flanger;
+					p_left[sample]             = m_flanger[0].doFlanger(p_left[sample]);
+					p_right[sample]            = m_flanger[1].doFlanger(p_right[sample]);
 				}
-			} else if (m_reverb_position == fx_slot) {
-				if (*m_reverb_on) {
-					m_reverb_zita.process(stereo_signal);
+				m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::Flanger);
+			}
+		} else if (m_chorus_position == fx_slot) {
+			if (*m_chorus_on) {
+				for (int sample = 0; sample < p_num_samples; ++sample) {
+					m_mod_destinations.chorus = m_mono_destinations_block[sample].chorus;
+					p_left[sample]            = m_chorus[0].doChorus(p_left[sample]);
+					p_right[sample]           = m_chorus[1].doChorus(p_right[sample]);
 				}
+				m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::Chorus);
 			}
-		}
-
-		//===== OUTPUT ======
-
-		// apply volume & modulation
-		float master_vol_modded = m_master_smooth;
-		if (*m_master_mod) {
-			if (*m_master_mod < 0.f) {
-				//negative modulation just modulates down to -inf dB
-				master_vol_modded = m_master_smooth * (1.f + *m_master_mod);
-				master_vol_modded = master_vol_modded < 0 ? 0 : master_vol_modded;
-			} else {
-				if (m_master_smooth > MINUS_12_dB_GAIN) {
-					// volume level above -12dB, modulate to plus 12 dB
-					master_vol_modded *= pow(PLUS_12_dB_GAIN, *m_master_mod);
-					master_vol_modded = master_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : master_vol_modded;
-				} else {
-					// if volume level is below -12dB then just modulate up to 0dB
-					master_vol_modded += (1.f - master_vol_modded) * *m_master_mod;
-					master_vol_modded = master_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : master_vol_modded;
+		} else if (m_reverb_position == fx_slot) {
+			if (*m_reverb_on) {
+				for (int sample = 0; sample < p_num_samples; ++sample) {
+					float stereo_signal[2] = {p_left[sample], p_right[sample]};
+					m_reverb_zita.process(stereo_signal);
+					p_left[sample]  = stereo_signal[0];
+					p_right[sample] = stereo_signal[1];
 				}
+				m_cpu_profiler.lap(PROFILER_MONO_LANE, CpuProfiler::Reverb);
 			}
 		}
+	}
+}
 
-		auto *channelData   = buffer.getWritePointer(0);
-		channelData[sample] = stereo_signal[0] * master_vol_modded;
-		channelData         = buffer.getWritePointer(1);
-		channelData[sample] = stereo_signal[1] * master_vol_modded;
-
-	} // sample loop
+void OdinAudioProcessor::applyArpeggiatorEvent(const ArpEvent &p_event) {
+	if (p_event.velocity > 0) {
+		midiNoteOn(p_event.note, p_event.velocity, p_event.mod_1, p_event.mod_2);
+	} else {
+		midiNoteOff(p_event.note);
+	}
 }
@@ -124,6 +124,10 @@ void OdinAudioProcessor::readPatch(const ValueTree &newState) {
 			    m_value_tree_misc.getPropertyName(i).toString().toStdString());
 		}
 	}
+	// patches from before voice oversampling existed ran their voices at the host rate
+	if (!misc_tree.hasProperty("voice_oversampling")) {
+		m_value_tree_misc.setProperty("voice_oversampling", 1, nullptr);
+	}
 	const ValueTree &mod_tree = newStateMigrated.getChildWithName("mod");
 	for (int i = 0; i < m_value_tree_mod.getNumProperties(); ++i) {
 		if (mod_tree.hasProperty(m_value_tree_mod.getPropertyName(i))) {
@@ -22,7 +22,7 @@ void OdinAudioProcessor::setModulationPointers() {
 	//==============  SOURCES  ===============
 	//========================================
 
-	for (int voice = 0; voice < VOICES; ++voice) {
+	for (int voice = 0; voice < m_num_voices; ++voice) {
 		m_mod_sources.voice[voice].osc[0]          = &(m_osc_output[voice][0]);
 		m_mod_sources.voice[voice].osc[1]          = &(m_osc_output[voice][1]);
 		m_mod_sources.voice[voice].osc[2]          = &(m_osc_output[voice][2]);
@@ -41,15 +41,15 @@ void OdinAudioProcessor::setModulationPointers() {
 		m_mod_sources.voice[voice].random          = &(m_voice[voice].random_modulation);
 		m_mod_sources.voice[voice].arp_mod_1       = &(m_voice[voice].m_arp_mod_1);
 		m_mod_sources.voice[voice].arp_mod_2       = &(m_voice[voice].m_arp_mod_2);
+		m_mod_sources.voice[voice].global_adsr     = &(m_voice_mono_inputs[voice].global_env);
+		m_mod_sources.voice[voice].global_lfo      = &(m_voice_mono_inputs[voice].global_lfo);
+		m_mod_sources.voice[voice].x               = &(m_voice_mono_inputs[voice].x);
+		m_mod_sources.voice[voice].y               = &(m_voice_mono_inputs[voice].y);
+		m_mod_sources.voice[voice].modwheel        = &(m_voice_mono_inputs[voice].modwheel);
+		m_mod_sources.voice[voice].pitchwheel      = &(m_voice_mono_inputs[voice].pitchwheel);
 	}
-	m_mod_sources.global_adsr           = &m_global_env_mod_source;
-	m_mod_sources.global_lfo            = &m_global_lfo_mod_source;
 	m_mod_sources.MIDI_channel_pressure = &(m_MIDI_channel_pressure);
 	m_mod_sources.MIDI_breath           = &(m_midi_breath);
-	m_mod_sources.x                     = &m_x_modded;
-	m_mod_sources.y                     = &m_y_modded;
-	m_mod_sources.modwheel              = &m_modwheel_smooth;
-	m_mod_sources.pitchwheel            = &m_pitch_bend_smooth;
 	m_mod_sources.constant              = &(m_constant);
 	m_mod_sources.sustain_pedal         = &(m_voice_manager.m_sustain_active_float);
 	m_mod_sources.soft_pedal            = &(m_soft_pedal);
@@ -57,18 +57,18 @@ void OdinAudioProcessor::setModulationPointers() {
 	//========================================
 	//============= DESTINATIONS =============
 	//========================================
-	for (int voice = 0; voice < VOICES; ++voice) {
+	for (int voice = 0; voice < m_num_voices; ++voice) {
 		for (int osc = 0; osc < 3; ++osc) {
-			m_voice[voice].analog_osc[osc].setPitchBendPointer(&(m_pitch_bend_smooth_and_applied));
-			m_voice[voice].wavetable_osc[osc].setPitchBendPointer(&(m_pitch_bend_smooth_and_applied));
-			m_voice[voice].multi_osc[osc].setPitchBendPointer(&(m_pitch_bend_smooth_and_applied));
-			m_voice[voice].vector_osc[osc].setPitchBendPointer(&(m_pitch_bend_smooth_and_applied));
-			m_voice[voice].fm_osc[osc].setPitchBendPointer(&(m_pitch_bend_smooth_and_applied));
-			m_voice[voice].pm_osc[osc].setPitchBendPointer(&(m_pitch_bend_smooth_and_applied));
-			m_voice[voice].chiptune_osc[osc].setPitchBendPointer(&(m_pitch_bend_smooth_and_applied));
-			m_voice[voice].wavedraw_osc[osc].setPitchBendPointer(&(m_pitch_bend_smooth_and_applied));
-			m_voice[voice].chipdraw_osc[osc].setPitchBendPointer(&(m_pitch_bend_smooth_and_applied));
-			m_voice[voice].specdraw_osc[osc].setPitchBendPointer(&(m_pitch_bend_smooth_and_applied));
+			m_voice[voice].analog_osc[osc].setPitchBendPointer(&(m_voice_mono_inputs[voice].pitch_bend_applied));
+			m_voice[voice].wavetable_osc[osc].setPitchBendPointer(&(m_voice_mono_inputs[voice].pitch_bend_applied));
+			m_voice[voice].multi_osc[osc].setPitchBendPointer(&(m_voice_mono_inputs[voice].pitch_bend_applied));
+			m_voice[voice].vector_osc[osc].setPitchBendPointer(&(m_voice_mono_inputs[voice].pitch_bend_applied));
+			m_voice[voice].fm_osc[osc].setPitchBendPointer(&(m_voice_mono_inputs[voice].pitch_bend_applied));
+			m_voice[voice].pm_osc[osc].setPitchBendPointer(&(m_voice_mono_inputs[voice].pitch_bend_applied));
+			m_voice[voice].chiptune_osc[osc].setPitchBendPointer(&(m_voice_mono_inputs[voice].pitch_bend_applied));
+			m_voice[voice].wavedraw_osc[osc].setPitchBendPointer(&(m_voice_mono_inputs[voice].pitch_bend_applied));
+			m_voice[voice].chipdraw_osc[osc].setPitchBendPointer(&(m_voice_mono_inputs[voice].pitch_bend_applied));
+			m_voice[voice].specdraw_osc[osc].setPitchBendPointer(&(m_voice_mono_inputs[voice].pitch_bend_applied));
 
 			m_voice[voice].analog_osc[osc].setPitchModExpPointer(
 			    &(m_mod_destinations.voice[voice].osc[osc].pitch_exponential));
@@ -91,16 +91,16 @@ void OdinAudioProcessor::setModulationPointers() {
 			m_voice[voice].specdraw_osc[osc].setPitchModExpPointer(
 			    &(m_mod_destinations.voice[voice].osc[osc].pitch_exponential));
 
-			m_voice[voice].analog_osc[osc].setGlidePointer(&(m_mod_destinations.misc.glide));
-			m_voice[voice].wavetable_osc[osc].setGlidePointer(&(m_mod_destinations.misc.glide));
-			m_voice[voice].multi_osc[osc].setGlidePointer(&(m_mod_destinations.misc.glide));
-			m_voice[voice].vector_osc[osc].setGlidePointer(&(m_mod_destinations.misc.glide));
-			m_voice[voice].fm_osc[osc].setGlidePointer(&(m_mod_destinations.misc.glide));
-			m_voice[voice].pm_osc[osc].setGlidePointer(&(m_mod_destinations.misc.glide));
-			m_voice[voice].chiptune_osc[osc].setGlidePointer(&(m_mod_destinations.misc.glide));
-			m_voice[voice].wavedraw_osc[osc].setGlidePointer(&(m_mod_destinations.misc.glide));
-			m_voice[voice].chipdraw_osc[osc].setGlidePointer(&(m_mod_destinations.misc.glide));
-			m_voice[voice].specdraw_osc[osc].setGlidePointer(&(m_mod_destinations.misc.glide));
+			m_voice[voice].analog_osc[osc].setGlidePointer(&(m_voice_mono_inputs[voice].glide));
+			m_voice[voice].wavetable_osc[osc].setGlidePointer(&(m_voice_mono_inputs[voice].glide));
+			m_voice[voice].multi_osc[osc].setGlidePointer(&(m_voice_mono_inputs[voice].glide));
+			m_voice[voice].vector_osc[osc].setGlidePointer(&(m_voice_mono_inputs[voice].glide));
+			m_voice[voice].fm_osc[osc].setGlidePointer(&(m_voice_mono_inputs[voice].glide));
+			m_voice[voice].pm_osc[osc].setGlidePointer(&(m_voice_mono_inputs[voice].glide));
+			m_voice[voice].chiptune_osc[osc].setGlidePointer(&(m_voice_mono_inputs[voice].glide));
+			m_voice[voice].wavedraw_osc[osc].setGlidePointer(&(m_voice_mono_inputs[voice].glide));
+			m_voice[voice].chipdraw_osc[osc].setGlidePointer(&(m_voice_mono_inputs[voice].glide));
+			m_voice[voice].specdraw_osc[osc].setGlidePointer(&(m_voice_mono_inputs[voice].glide));
 
 			m_voice[voice].analog_osc[osc].setPitchModLinPointer(
 			    &(m_mod_destinations.voice[voice].osc[osc].pitch_linear));
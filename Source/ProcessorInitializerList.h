@@ -173,6 +173,7 @@ m_osc1_type_identifier("osc1_type"), m_osc2_type_identifier("osc2_type"),
     m_arp_steps_identifier("arp_steps"),
     m_arp_gate_identifier("arp_gate"),
     m_dist_algo_identifier("dist_algo"),
+    m_voice_oversampling_identifier("voice_oversampling"),
     m_fil1_to_amp_identifier("fil1_to_amp"),
     m_fil2_to_amp_identifier("fil2_to_amp"),
     m_env1_attack_identifier("env1_attack"),
@@ -405,6 +406,7 @@ m_osc1_type_identifier("osc1_type"), m_osc2_type_identifier("osc2_type"),
     m_scale_row_7_identifier("scale_row_6"),
     m_scale_row_8_identifier("scale_row_7"),
     m_scale_row_9_identifier("scale_row_8"), m_BPM_identifier("BPM"), 
+    m_unison_voices_identifier("unison_voices"),
     m_value_tree_draw("draw"),
 	m_value_tree_fx("fx"),
 	m_value_tree_lfo("lfo"),
@@ -0,0 +1,252 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "RealtimeChecker.h"
+
+#ifdef ODIN_RT_CHECK
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+// plain thread locals without constructors, the interceptors may run before or after static initialization
+static thread_local int t_realtime_depth = 0;
+static thread_local int t_permit_depth   = 0;
+
+static std::atomic<int> s_num_violations{0};
+static std::atomic<bool> s_abort_on_violation{false};
+
+RealtimeChecker::ScopedSection::ScopedSection() {
+	++t_realtime_depth;
+}
+
+RealtimeChecker::ScopedSection::~ScopedSection() {
+	--t_realtime_depth;
+}
+
+RealtimeChecker::ScopedPermit::ScopedPermit() {
+	++t_permit_depth;
+}
+
+RealtimeChecker::ScopedPermit::~ScopedPermit() {
+	--t_permit_depth;
+}
+
+int RealtimeChecker::getNumViolations() {
+	return s_num_violations.load();
+}
+
+void RealtimeChecker::resetViolations() {
+	s_num_violations.store(0);
+}
+
+void RealtimeChecker::setAbortOnViolation(bool p_abort) {
+	s_abort_on_violation.store(p_abort);
+}
+
+void RealtimeChecker::check(const char *p_what) {
+	if (t_realtime_depth == 0 || t_permit_depth > 0) {
+		return;
+	}
+	// the report itself allocates and locks
+	ScopedPermit permit;
+	++s_num_violations;
+	const juce::String backtrace = juce::SystemStats::getStackBacktrace();
+	std::fprintf(stderr, "[rt-check] %s on a real-time thread\n%s\n", p_what, backtrace.toRawUTF8());
+	std::fflush(stderr);
+	if (s_abort_on_violation.load()) {
+		std::abort();
+	}
+}
+
+//==============================================================================
+//================================ INTERCEPTORS ================================
+//==============================================================================
+
+#if defined(__GLIBC__)
+
+#include <cerrno>
+#include <cstdarg>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+// glibc exports its allocator under these names as well, so the interceptors don't have to look them up
+extern "C" void *__libc_malloc(size_t p_size);
+extern "C" void *__libc_calloc(size_t p_num, size_t p_size);
+extern "C" void *__libc_realloc(void *p_pointer, size_t p_size);
+extern "C" void *__libc_memalign(size_t p_alignment, size_t p_size);
+extern "C" void *__libc_valloc(size_t p_size);
+extern "C" void __libc_free(void *p_pointer);
+
+template <typename Function> static Function nextSymbol(Function &p_cache, const char *p_name) {
+	if (!p_cache) {
+		p_cache = (Function)dlsym(RTLD_NEXT, p_name);
+	}
+	return p_cache;
+}
+
+extern "C" {
+
+void *malloc(size_t p_size) {
+	RealtimeChecker::check("malloc");
+	return __libc_malloc(p_size);
+}
+
+void *calloc(size_t p_num, size_t p_size) {
+	RealtimeChecker::check("calloc");
+	return __libc_calloc(p_num, p_size);
+}
+
+void *realloc(void *p_pointer, size_t p_size) {
+	RealtimeChecker::check("realloc");
+	return __libc_realloc(p_pointer, p_size);
+}
+
+int posix_memalign(void **po_pointer, size_t p_alignment, size_t p_size) {
+	RealtimeChecker::check("posix_memalign");
+	*po_pointer = __libc_memalign(p_alignment, p_size);
+	return *po_pointer ? 0 : ENOMEM;
+}
+
+void *aligned_alloc(size_t p_alignment, size_t p_size) {
+	RealtimeChecker::check("aligned_alloc");
+	return __libc_memalign(p_alignment, p_size);
+}
+
+void *memalign(size_t p_alignment, size_t p_size) {
+	RealtimeChecker::check("memalign");
+	return __libc_memalign(p_alignment, p_size);
+}
+
+void *valloc(size_t p_size) {
+	RealtimeChecker::check("valloc");
+	return __libc_valloc(p_size);
+}
+
+void free(void *p_pointer) {
+	if (p_pointer) {
+		RealtimeChecker::check("free");
+	}
+	__libc_free(p_pointer);
+}
+
+int pthread_mutex_lock(pthread_mutex_t *p_mutex) {
+	static int (*next)(pthread_mutex_t *) = nullptr;
+	RealtimeChecker::check("pthread_mutex_lock");
+	return nextSymbol(next, "pthread_mutex_lock")(p_mutex);
+}
+
+// waiting on another thread blocks for as long as that thread needs, even with a timeout
+int pthread_cond_wait(pthread_cond_t *p_condition, pthread_mutex_t *p_mutex) {
+	static int (*next)(pthread_cond_t *, pthread_mutex_t *) = nullptr;
+	RealtimeChecker::check("pthread_cond_wait");
+	return nextSymbol(next, "pthread_cond_wait")(p_condition, p_mutex);
+}
+
+int pthread_cond_timedwait(pthread_cond_t *p_condition, pthread_mutex_t *p_mutex, const struct timespec *p_time) {
+	static int (*next)(pthread_cond_t *, pthread_mutex_t *, const struct timespec *) = nullptr;
+	RealtimeChecker::check("pthread_cond_timedwait");
+	return nextSymbol(next, "pthread_cond_timedwait")(p_condition, p_mutex, p_time);
+}
+
+int sem_wait(sem_t *p_semaphore) {
+	static int (*next)(sem_t *) = nullptr;
+	RealtimeChecker::check("sem_wait");
+	return nextSymbol(next, "sem_wait")(p_semaphore);
+}
+
+int sem_timedwait(sem_t *p_semaphore, const struct timespec *p_time) {
+	static int (*next)(sem_t *, const struct timespec *) = nullptr;
+	RealtimeChecker::check("sem_timedwait");
+	return nextSymbol(next, "sem_timedwait")(p_semaphore, p_time);
+}
+
+int open(const char *p_path, int p_flags, ...) {
+	static int (*next)(const char *, int, ...) = nullptr;
+	RealtimeChecker::check("open");
+	va_list args;
+	va_start(args, p_flags);
+	const mode_t mode = (p_flags & O_CREAT) ? (mode_t)va_arg(args, int) : 0;
+	va_end(args);
+	return nextSymbol(next, "open")(p_path, p_flags, mode);
+}
+
+FILE *fopen(const char *p_path, const char *p_mode) {
+	static FILE *(*next)(const char *, const char *) = nullptr;
+	RealtimeChecker::check("fopen");
+	return nextSymbol(next, "fopen")(p_path, p_mode);
+}
+
+} // extern "C"
+
+#else
+
+// without glibc only the C++ allocations are caught
+void *operator new(std::size_t p_size) {
+	RealtimeChecker::check("operator new");
+	if (void *pointer = std::malloc(p_size ? p_size : 1)) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t p_size) {
+	RealtimeChecker::check("operator new[]");
+	if (void *pointer = std::malloc(p_size ? p_size : 1)) {
+		return pointer;
+	}
+	throw std::bad_alloc();
+}
+
+void *operator new(std::size_t p_size, const std::nothrow_t &) noexcept {
+	RealtimeChecker::check("operator new");
+	return std::malloc(p_size ? p_size : 1);
+}
+
+void *operator new[](std::size_t p_size, const std::nothrow_t &) noexcept {
+	RealtimeChecker::check("operator new[]");
+	return std::malloc(p_size ? p_size : 1);
+}
+
+void operator delete(void *p_pointer) noexcept {
+	if (p_pointer) {
+		RealtimeChecker::check("operator delete");
+	}
+	std::free(p_pointer);
+}
+
+void operator delete[](void *p_pointer) noexcept {
+	if (p_pointer) {
+		RealtimeChecker::check("operator delete[]");
+	}
+	std::free(p_pointer);
+}
+
+void operator delete(void *p_pointer, std::size_t) noexcept {
+	operator delete(p_pointer);
+}
+
+void operator delete[](void *p_pointer, std::size_t) noexcept {
+	operator delete[](p_pointer);
+}
+
+#endif
+
+#endif
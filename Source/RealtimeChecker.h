@@ -0,0 +1,76 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+/**
+ * Debugging aid which reports calls that must not happen on the audio thread. Build with
+ * -DODIN2_ENABLE_RT_CHECK=ON (defines ODIN_RT_CHECK), otherwise everything here compiles to nothing.
+ * A thread counts as real-time while a ScopedSection lives on it. Every heap allocation or free, mutex lock, wait on
+ * a condition or semaphore and file open made there is printed to stderr with a stack trace.
+ * On Linux (glibc) the malloc family (including memalign and valloc), free, pthread_mutex_lock, pthread_cond_wait,
+ * sem_wait (and their timed variants), open and fopen are intercepted, elsewhere only operator new and delete.
+ * With the option on, ctest runs odin2-render --rt-check. The interceptors only see calls made from within an executable (Standalone, render tool), a plugin loaded
+ * into a host still uses the host's allocator.
+ */
+class RealtimeChecker {
+public:
+#ifdef ODIN_RT_CHECK
+	// marks the current thread as real-time until destroyed, sections can be nested
+	class ScopedSection {
+	public:
+		ScopedSection();
+		~ScopedSection();
+	};
+
+	// lets a known violation through, e.g. waking a sleeping thread
+	class ScopedPermit {
+	public:
+		ScopedPermit();
+		~ScopedPermit();
+	};
+
+	// number of violations reported since the last reset, from all threads
+	static int getNumViolations();
+	static void resetViolations();
+	// stops the program on the first violation, so it can be looked at in the debugger
+	static void setAbortOnViolation(bool p_abort);
+
+	// called by the interceptors, reports p_what if the current thread is real-time
+	static void check(const char *p_what);
+#else
+	class ScopedSection {
+	public:
+		ScopedSection() {
+		}
+	};
+
+	class ScopedPermit {
+	public:
+		ScopedPermit() {
+		}
+	};
+
+	static int getNumViolations() {
+		return 0;
+	}
+	static void resetViolations() {
+	}
+	static void setAbortOnViolation(bool p_abort) {
+	}
+	static void check(const char *p_what) {
+	}
+#endif
+};
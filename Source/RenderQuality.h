@@ -0,0 +1,36 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "GlobalIncludes.h"
+
+/**
+ * What the processor trades for cpu. Live playback renders with the eco profile, offline renders (the host reports
+ * isNonRealtime()) with the high quality one. The processor switches between them by itself.
+ * Eco is what every patch sounded like before the profiles existed, so it never changes the live sound. The half rate
+ * reverb is a separate opt-in from the config file, see OdinAudioProcessor::setReverbHalfRate()
+ */
+struct RenderQuality {
+	// the mod matrix control rate, 0 keeps the one from the config file
+	int control_rate;
+	// the lowest voice oversampling factor, the patch can ask for more
+	int voice_oversampling;
+	// cubic instead of linear interpolation in WavetableOsc1D
+	bool cubic_interpolation;
+};
+
+static const RenderQuality RENDER_QUALITY_ECO  = {0, 1, false};
+static const RenderQuality RENDER_QUALITY_HIGH = {1, VOICE_OVERSAMPLING_MAX, true};
@@ -26,7 +26,8 @@ float Chorus::doChorus(float p_input) {
     jassert(m_samplerate > 0);
 
 	//param smoothing
-	m_amount = (m_amount - m_amount_control) * 0.995 + m_amount_control;
+	m_amount.setTarget(m_amount_control);
+	const float amount = m_amount.next();
 
 	float LFO_sine;
 	float LFO_cosine;
@@ -37,7 +38,7 @@ float Chorus::doChorus(float p_input) {
 	LFO_sine   = LFO_sine * 0.5f + 0.5f;
 	LFO_cosine = LFO_cosine * 0.5f + 0.5f;
 
-	float amount_modded = m_amount + *m_amount_mod;
+	float amount_modded = amount + *m_amount_mod;
 	amount_modded       = amount_modded < 0 ? 0 : amount_modded;
 	// amount_modded = amount_modded < 0 ? 0 : amount_modded;
 
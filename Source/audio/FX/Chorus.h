@@ -17,6 +17,8 @@
 #pragma once
 #include "../JuceLibraryCode/JuceHeader.h"
 #include "../Filters/BiquadAllpass.h"
+#include "../OdinConstants.h"
+#include "../ParameterSmoother.h"
 
 #include <cmath>
 #include <cstring>
@@ -59,7 +61,7 @@ public:
     m_allpass1.reset();
     m_allpass2.reset();
     m_LFO_pos = 0;
-    m_amount = m_amount_control;
+    m_amount.reset(m_amount_control);
   }
 
   inline void incLFO() {
@@ -100,6 +102,11 @@ public:
   }
   void setFeedback(float p_feedback) { m_feedback = p_feedback; }
 
+  // seconds until the feedback has decayed to silence, assumes the longest modulated delay
+  float getTailLength() const {
+    return feedbackTailLength(CHORUS_MIN_DISTANCE_1 + CHORUS_AMOUNT_RANGE, m_feedback + *m_feedback_mod);
+  }
+
   void resetLFO() { m_LFO_pos = m_LFO_reset_pos; }
 
   void setFreqModPointer(float *p_pointer) { m_freq_mod = p_pointer; }
@@ -145,7 +152,7 @@ protected:
   float m_LFO_pos = 0;
   float m_LFO_freq = 0.15;
   float m_LFO_reset_pos = 0;
-  float m_amount = 0.16f;//0.4^2
+  ParameterSmoother m_amount{0.995f, 0.16f};//0.4^2
   float m_amount_control = 0.16f;//0.4^2
   int m_write_index = 0;
   float m_feedback = 0;
@@ -33,9 +33,9 @@ float Delay::doDelayLeft(float p_left) {
 	float input_left = p_left;
 
 	// smooth only in left delay line
-	m_delay_time_smooth = (m_delay_time_smooth - m_delay_time_control) * 0.99994 + m_delay_time_control;
+	m_delay_time_smooth.setTarget(m_delay_time_control);
 
-	float delay_time_modded = m_delay_time_smooth;
+	float delay_time_modded = m_delay_time_smooth.next();
 	if (*m_time_mod) {
 		delay_time_modded *= pow(3, *m_time_mod);
 	}
@@ -93,7 +93,7 @@ float Delay::doDelayRight(float p_right) {
 
 	float input_right = p_right;
 
-	float delay_time_modded = m_delay_time_smooth;
+	float delay_time_modded = m_delay_time_smooth.getValue();
 	if (*m_time_mod) {
 		delay_time_modded *= pow(3, *m_time_mod);
 	}
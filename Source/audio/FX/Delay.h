@@ -18,6 +18,7 @@
 #include "../Filters/DCBlockingFilter.h"
 #include "../Filters/VAOnePoleFilter.h"
 #include "../OdinConstants.h"
+#include "../ParameterSmoother.h"
 
 //#include <memory>
 #include <cstring>
@@ -41,6 +42,13 @@ public:
 
   inline void setFeedback(float p_feedback) { m_feedback = p_feedback; }
 
+  // seconds until the repeats have decayed to silence
+  inline float getTailLength() const {
+    const float delay_time_smooth = m_delay_time_smooth.getValue();
+    const float delay_time = delay_time_smooth > m_delay_time_control ? delay_time_smooth : m_delay_time_control;
+    return feedbackTailLength(delay_time, m_feedback + *m_feedback_mod);
+  }
+
   inline void setSampleRate(float p_samplerate) { 
   //DBG("setsamplerate delay");
     m_samplerate = p_samplerate;
@@ -80,7 +88,7 @@ public:
     m_highpass_left.reset();
     m_highpass_right.reset();
 
-    m_delay_time_smooth = m_delay_time_control;
+    m_delay_time_smooth.reset(m_delay_time_control);
 
     m_DC_blocking_filter_left.reset();
     m_DC_blocking_filter_right.reset();
@@ -154,7 +162,8 @@ protected:
 
   // need to be init by synth
   float m_delay_time_control = 1.f;
-  float m_delay_time_smooth = 1.f;
+  // settles at a fraction of a sample, a bigger jump in the read position would click
+  ParameterSmoother m_delay_time_smooth{0.99994f, 1.f, 0.000001f};
   float m_feedback = 0.45;
   float m_samplerate = -1;
   float m_dry = 1.f;
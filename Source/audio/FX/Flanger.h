@@ -54,6 +54,11 @@ public:
     setResonance(p_feedback);
   }
 
+  // seconds until the feedback has decayed to silence, assumes the longest modulated delay
+  float getTailLength() const {
+    return feedbackTailLength(m_base_time + FLANGER_LFO_MAX_RANGE, m_feedback + *m_res_mod);
+  }
+
   inline void setLFOAmount(float p_LFO_amount) { m_LFO_amount = p_LFO_amount; }
 
   inline void setDryWet(float p_dry_wet) { m_dry_wet = p_dry_wet; }
@@ -25,64 +25,84 @@ OversamplingDistortion::~OversamplingDistortion() {
 
 double OversamplingDistortion::doDistortion(double p_input) {
 
-	// do linear interpolation
-	double input_upsampled[3] = {
-	    0.66666666 * m_last_input + 0.33333333 * p_input, 0.33333333 * m_last_input + 0.66666666 * p_input, p_input};
-
-	m_last_input = p_input;
-
-	m_threshold_smooth =
-	    m_threshold_smooth * THRESHOLD_SMOOTHIN_FACTOR + (1 - THRESHOLD_SMOOTHIN_FACTOR) * (m_threshold);
+	m_threshold_smooth.setTarget(m_threshold);
 
 	//theshold is now boost, so we need to subtract mod (control setter is inverted as well)
-	float threshold_modded = (m_threshold_smooth - *m_threshold_mod) * (1.f - THRESHOLD_MIN) + THRESHOLD_MIN;
+	float threshold_modded = (m_threshold_smooth.next() - *m_threshold_mod) * (1.f - THRESHOLD_MIN) + THRESHOLD_MIN;
 	threshold_modded       = threshold_modded > 1 ? 1 : threshold_modded;
 	threshold_modded       = threshold_modded < THRESHOLD_MIN ? THRESHOLD_MIN : threshold_modded;
+	if (m_algorithm == Zero) {
+		// half "boost" for zero
+		threshold_modded = 0.5f + threshold_modded * 0.5f;
+	}
+
+	const double distorted =
+	    m_internal_oversampling ? distortOversampled(p_input, threshold_modded) : distortSample(p_input, threshold_modded);
+	m_last_input = p_input;
+
+	float drywet_modded = m_drywet + *m_drywet_mod;
+	drywet_modded       = drywet_modded > 1 ? 1 : drywet_modded;
+	drywet_modded       = drywet_modded < 0 ? 0 : drywet_modded;
 
-	// do distortion
 	switch (m_algorithm) {
 	case Clamp:
-		for (int sample = 0; sample < 3; ++sample) {
-			if (input_upsampled[sample] > m_bias && input_upsampled[sample] > m_bias + threshold_modded) {
-				input_upsampled[sample] = m_bias + threshold_modded;
-			} else if (input_upsampled[sample] < m_bias && input_upsampled[sample] < m_bias - threshold_modded) {
-				input_upsampled[sample] = m_bias - threshold_modded;
-			}
-		}
+	case Fold:
+	case Zero:
+		return distorted * drywet_modded / threshold_modded * DISTORTION_OUTPUT_SCALAR + p_input * (1.f - drywet_modded);
+	case Sine:
+	case Cube:
+		return distorted * drywet_modded + p_input * (1.f - drywet_modded);
+	default:
+		return p_input;
 		break;
+	}
+}
+
+double OversamplingDistortion::distortSample(double p_sample, float p_threshold) {
+	switch (m_algorithm) {
+	case Clamp:
+		if (p_sample > m_bias && p_sample > m_bias + p_threshold) {
+			return m_bias + p_threshold;
+		} else if (p_sample < m_bias && p_sample < m_bias - p_threshold) {
+			return m_bias - p_threshold;
+		}
+		return p_sample;
 	case Zero:
-		// half "boost" for zero
-		threshold_modded = 0.5f + threshold_modded * 0.5f;
-		for (int sample = 0; sample < 3; ++sample) {
-			if (input_upsampled[sample] > m_bias && input_upsampled[sample] > m_bias + threshold_modded) {
-				input_upsampled[sample] = 0.;
-			} else if (input_upsampled[sample] < m_bias && input_upsampled[sample] < m_bias - threshold_modded) {
-				input_upsampled[sample] = 0.;
-			}
+		if (p_sample > m_bias && p_sample > m_bias + p_threshold) {
+			return 0.;
+		} else if (p_sample < m_bias && p_sample < m_bias - p_threshold) {
+			return 0.;
 		}
-		break;
+		return p_sample;
 	case Sine:
-		for (int sample = 0; sample < 3; ++sample) {
-			input_upsampled[sample] = sin(input_upsampled[sample] /*/ threshold_modded*/);
-		}
+		p_sample = sin(p_sample /*/ threshold_modded*/);
 	case Cube:
-		for (int sample = 0; sample < 3; ++sample) {
-			//input_upsampled[sample] /= threshold_modded;
-			input_upsampled[sample] *= input_upsampled[sample] * input_upsampled[sample];
-		}
-		break;
+		//p_sample /= threshold_modded;
+		return p_sample * p_sample * p_sample;
 	case Fold:
-		for (int sample = 0; sample < 3; ++sample) {
-			//threshold_modded = threshold_modded < 0.05 ? 0.05 : threshold_modded;
-			while (fabs(input_upsampled[sample]) > threshold_modded) {
-				if (input_upsampled[sample] > threshold_modded) {
-					input_upsampled[sample] = 2 * threshold_modded - input_upsampled[sample];
-				} else {
-					input_upsampled[sample] = -2 * threshold_modded - input_upsampled[sample];
-				}
+		//threshold_modded = threshold_modded < 0.05 ? 0.05 : threshold_modded;
+		while (fabs(p_sample) > p_threshold) {
+			if (p_sample > p_threshold) {
+				p_sample = 2 * p_threshold - p_sample;
+			} else {
+				p_sample = -2 * p_threshold - p_sample;
 			}
 		}
-		break;
+		return p_sample;
+	default:
+		return p_sample;
+	}
+}
+
+double OversamplingDistortion::distortOversampled(double p_input, float p_threshold) {
+
+	// do linear interpolation
+	double input_upsampled[3] = {
+	    0.66666666 * m_last_input + 0.33333333 * p_input, 0.33333333 * m_last_input + 0.66666666 * p_input, p_input};
+
+	// do distortion
+	for (int sample = 0; sample < 3; ++sample) {
+		input_upsampled[sample] = distortSample(input_upsampled[sample], p_threshold);
 	}
 
 	// do downsamplingfilter: The filter coefficients are generated by
@@ -160,21 +180,5 @@ double OversamplingDistortion::doDistortion(double p_input) {
 	        (-0.2185829743 * yv[3]) + (-0.6649234123 * yv[4]) + (-1.4773657709 * yv[5]) + (-2.2721421641 * yv[6]) +
 	        (-2.6598673212 * yv[7]) + (-1.8755960587 * yv[8]);
 
-	float drywet_modded = m_drywet + *m_drywet_mod;
-	drywet_modded       = drywet_modded > 1 ? 1 : drywet_modded;
-	drywet_modded       = drywet_modded < 0 ? 0 : drywet_modded;
-
-	// return only the last of the three samples
-	switch (m_algorithm) {
-	case Clamp:
-	case Fold:
-	case Zero:
-		return yv[9] * drywet_modded / threshold_modded * DISTORTION_OUTPUT_SCALAR + p_input * (1.f - drywet_modded);
-	case Sine:
-	case Cube:
-		return yv[9] * drywet_modded + p_input * (1.f - drywet_modded);
-	default:
-		return p_input;
-		break;
-	}
+	return yv[9];
 }
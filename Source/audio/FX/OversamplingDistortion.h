@@ -15,6 +15,9 @@
 
 #pragma once
 
+#include "../../GlobalIncludes.h"
+#include "../ParameterSmoother.h"
+
 #define THRESHOLD_MIN 0.05f
 #define DISTORTION_OUTPUT_SCALAR 1.0
 
@@ -48,14 +51,21 @@ public:
 
   void setDryWetModPointer(float *p_pointer) { m_drywet_mod = p_pointer; }
 
+  // the distortion is oversampled 3x unless the whole voice already runs oversampled
+  void setInternalOversampling(bool p_enabled) { m_internal_oversampling = p_enabled; }
+
   void reset() {
     for (int i = 0; i < 10; ++i) {
       xv[i] = yv[i] = 0;
     }
-    m_threshold_smooth = m_threshold;
+    m_threshold_smooth.reset(m_threshold);
   }
 
 protected:
+  double distortSample(double p_sample, float p_threshold);
+  // upsamples 3x by linear interpolation, distorts and filters, returns the last of the three samples
+  double distortOversampled(double p_input, float p_threshold);
+
   float *m_threshold_mod;
   float *m_drywet_mod;
 
@@ -65,8 +75,9 @@ protected:
   double m_last_input = 0.f;
   float m_bias = 0.f;
   float m_threshold = 0.343f;        //(1-0.3)^3
-  float m_threshold_smooth = 0.343f; //(1-0.3)^3
+  ParameterSmoother m_threshold_smooth{THRESHOLD_SMOOTHIN_FACTOR, 0.343f}; //(1-0.3)^3
   float m_drywet = 1.f;
+  bool m_internal_oversampling = true;
 
   // IIR Filter buffers for downsampling
   // coefficients (see implementation) are taken from
@@ -140,7 +140,6 @@ void ParametricEQ::process1(float data[]) {
 		_c2 = c2;
 		_gg = gg;
 	} else {
-		DBG("NON SMOOTH");
 		for (i = 0; i < 2 /*nchan*/; i++) {
 			p  = &(data[i]);
 			z1 = _z1[i];
@@ -17,9 +17,11 @@
 #include "../JuceLibraryCode/JuceHeader.h"
 
 #include "../Filters/BiquadAllpass.h"
+#include "../OdinConstants.h"
 #include <cmath>
 
 #define PHASER_MAX_LFO_AMPLITUDE 4000
+#define PHASER_TAIL_LOOP_TIME 0.005f
 
 class Phaser {
 public:
@@ -121,6 +123,12 @@ public:
   void setFeedbackModPointer(float *p_pointer) { m_feedback_mod = p_pointer; }
 
   void setFeedback(float p_feedback) { m_feedback = p_feedback * 0.97; }
+
+  // seconds until the feedback has decayed to silence. The allpass chain has no fixed delay, so the round trip
+  // is estimated with its group delay at low frequencies
+  float getTailLength() const {
+    return feedbackTailLength(PHASER_TAIL_LOOP_TIME, m_feedback + *m_feedback_mod);
+  }
   void resetLFO() {
     m_index_sine_left = 0;
     m_index_sine_right = 0.5;
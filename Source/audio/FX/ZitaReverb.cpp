@@ -17,6 +17,7 @@
 // https://github.com/royvegard/zita-rev1 for the original code.
 
 #include "ZitaReverb.h"
+#include "../OdinConstants.h"
 #include <math.h>
 #include <stdio.h>
 #include <string.h>
@@ -40,8 +41,9 @@ void Diff1::init(int size, float c) {
 	if (_size != 0)
 		delete[] _line;
 
-	_size = size;
-	_line = new float[size];
+	_size     = size;
+	_capacity = size;
+	_line     = new float[size];
 	if (_line) {
 		memset(_line, 0, size * sizeof(float));
 	}
@@ -49,13 +51,20 @@ void Diff1::init(int size, float c) {
 	_c = c;
 }
 
+void Diff1::resize(int size) {
+	jassert(size > 0 && size <= _capacity);
+	_size = size;
+	_i    = 0;
+}
+
 void Diff1::fini(void) {
 	//deallocate if needed
 	if (_size != 0)
 		delete[] _line;
 
-	_size = 0;
-	_line = 0;
+	_size     = 0;
+	_capacity = 0;
+	_line     = 0;
 }
 
 void Filt1::reset() {
@@ -77,12 +86,19 @@ void RevDelay::init(int size) {
 	if (_size != 0)
 		delete[] _line;
 
-	_size = size;
-	_line = new float[size];
+	_size     = size;
+	_capacity = size;
+	_line     = new float[size];
 	memset(_line, 0, size * sizeof(float));
 	_i = 0;
 }
 
+void RevDelay::resize(int size) {
+	jassert(size > 0 && size <= _capacity);
+	_size = size;
+	_i    = 0;
+}
+
 void RevDelay::reset() {
 	if (_size != 0) {
 		memset(_line, 0, _size * sizeof(float));
@@ -92,8 +108,9 @@ void RevDelay::reset() {
 
 void RevDelay::fini(void) {
 	delete[] _line;
-	_size = 0;
-	_line = 0;
+	_size     = 0;
+	_capacity = 0;
+	_line     = 0;
 }
 
 // -----------------------------------------------------------------------
@@ -110,20 +127,29 @@ void Vdelay::init(int size) {
 	if (_size != 0)
 		delete[] _line;
 
-	_size = size;
-	_line = new float[size];
+	_size     = size;
+	_capacity = size;
+	_line     = new float[size];
 	memset(_line, 0, size * sizeof(float));
 	_ir = 0;
 	_iw = 0;
 }
 
+void Vdelay::resize(int size) {
+	jassert(size > 0 && size <= _capacity);
+	_size = size;
+	_ir   = 0;
+	_iw   = 0;
+}
+
 void Vdelay::fini(void) {
 	//deallocate if needed
 	if (_size != 0)
 		delete[] _line;
 
-	_size = 0;
-	_line = 0;
+	_size     = 0;
+	_capacity = 0;
+	_line     = 0;
 }
 
 void Vdelay::reset() {
@@ -192,6 +218,7 @@ void ZitaReverb::setSampleRate(float fsamp) {
 	_g1 = _d1 = 0;
 
 	//TODO MEMORY LEAK!!!!
+	// allocated for the full rate, so switching to half rate only has to shorten them
 	_vdelay0.init((int)(0.1f * _fsamp));
 	_vdelay1.init((int)(0.1f * _fsamp));
 	for (i = 0; i < 8; i++) {
@@ -205,6 +232,35 @@ void ZitaReverb::setSampleRate(float fsamp) {
 	_pareq[1].setSampleRate(fsamp);
 
 	//_pareq2.setfsamp(fsamp);
+
+	configureRate();
+}
+
+void ZitaReverb::setHalfRate(bool p_half_rate) {
+	if (p_half_rate != _half_rate) {
+		_half_rate = p_half_rate;
+		configureRate();
+	}
+}
+
+void ZitaReverb::configureRate() {
+	int i, k1, k2;
+
+	_frate = _half_rate ? 0.5f * _fsamp : _fsamp;
+
+	_vdelay0.resize((int)(0.1f * _frate));
+	_vdelay1.resize((int)(0.1f * _frate));
+	for (i = 0; i < 8; i++) {
+		k1 = (int)(floorf(_tdiff1[i] * _frate + 0.5f));
+		k2 = (int)(floorf(_tdelay[i] * _frate + 0.5f));
+		_diff1[i].resize(k1);
+		_delay[i].resize(k2 - k1);
+	}
+
+	// the predelay and the filters of the network depend on its rate
+	_Adirty = _Bdirty = true;
+	prepare();
+	reset();
 }
 
 void ZitaReverb::fini(void) {
@@ -223,7 +279,7 @@ void ZitaReverb::prepare() {
 	_d0 = _d1 = 0;
 
 	if (_Adirty) {
-		k = (int)(floorf((_ipdel - 0.020f) * _fsamp + 0.5f));
+		k = (int)(floorf((_ipdel - 0.020f) * _frate + 0.5f));
 		_vdelay0.set_delay(k);
 		_vdelay1.set_delay(k);
 		//_cntA2 = _cntA1;
@@ -231,11 +287,11 @@ void ZitaReverb::prepare() {
 	}
 
 	if (_Bdirty) {
-		wlo = 6.2832f * _xover / _fsamp;
-		if (_fdamp > 0.49f * _fsamp)
+		wlo = 6.2832f * _xover / _frate;
+		if (_fdamp > 0.49f * _frate)
 			chi = 2;
 		else
-			chi = 1 - cosf(6.2832f * _fdamp / _fsamp);
+			chi = 1 - cosf(6.2832f * _fdamp / _frate);
 		for (i = 0; i < 8; i++) {
 			_filt1[i].set_params(_tdelay[i], _rtmid, _rtlow, wlo, 0.5f * _rtmid, chi);
 		}
@@ -279,12 +335,55 @@ void ZitaReverb::prepare() {
 }
 
 void ZitaReverb::process(float input[2]) {
+	float out[2];
+
+	if (_half_rate) {
+		// the network is fed the mean of each pair of samples and its output is interpolated, which costs a sample
+		// of latency on top of the predelay
+		if (_half_phase) {
+			const float network_input[2] = {0.5f * (_half_input[0] + input[0]), 0.5f * (_half_input[1] + input[1])};
+			_half_prev[0]                = _half_next[0];
+			_half_prev[1]                = _half_next[1];
+			processNetwork(network_input, _half_next);
+			out[0] = _half_prev[0];
+			out[1] = _half_prev[1];
+		} else {
+			_half_input[0] = input[0];
+			_half_input[1] = input[1];
+			out[0]         = 0.5f * (_half_prev[0] + _half_next[0]);
+			out[1]         = 0.5f * (_half_prev[1] + _half_next[1]);
+		}
+		_half_phase = !_half_phase;
+	} else {
+		processNetwork(input, out);
+	}
+
+	out[0] = _pareq[0].doFilter(out[0]);
+	out[1] = _pareq[1].doFilter(out[1]);
+
+	//_pareq2.process(out);
+	//for (i = 0; i < nfram; i++) {
+	//_g0 += _d0;
+	out[0] += _g0 * input[0];
+	out[1] += _g0 * input[1];
+	//}
+
+	// DBG("==");
+	// DBG_VAR(_g0);
+	// DBG_VAR(_g1);
+	// DBG_VAR(_d0);
+	// DBG_VAR(_d1);
+
+	input[0] = out[0];
+	input[1] = out[1];
+}
+
+void ZitaReverb::processNetwork(const float input[2], float out[2]) {
 
 	int i, n;
 	float *p0, *p1;
 	float *q0, *q1, *q2, *q3;
 	float t, g, x0, x1, x2, x3, x4, x5, x6, x7;
-	float out[2];
 
 	//g = sqrtf(0.125f);
 	g = 0.35355f;
@@ -364,25 +463,6 @@ void ZitaReverb::process(float input[2]) {
 	_delay[5].write(_filt1[5].process(g * x5));
 	_delay[6].write(_filt1[6].process(g * x6));
 	_delay[7].write(_filt1[7].process(g * x7));
-
-	out[0] = _pareq[0].doFilter(out[0]);
-	out[1] = _pareq[1].doFilter(out[1]);
-
-	//_pareq2.process(out);
-	//for (i = 0; i < nfram; i++) {
-	//_g0 += _d0;
-	out[0] += _g0 * input[0];
-	out[1] += _g0 * input[1];
-	//}
-
-	// DBG("==");
-	// DBG_VAR(_g0);
-	// DBG_VAR(_g1);
-	// DBG_VAR(_d0);
-	// DBG_VAR(_d1);
-
-	input[0] = out[0];
-	input[1] = out[1];
 }
 
 void ZitaReverb::set_delay(float v) {
@@ -460,6 +540,13 @@ void ZitaReverb::set_eq1_freq(float f) {
 	prepare();
 }
 
+float ZitaReverb::get_tail_length(void) const {
+	// RT60 times are for 60dB, scale them to the tail threshold and add the predelay and the longest delay line
+	const float rt     = _rtlow > _rtmid ? _rtlow : _rtmid;
+	const float decays = -20.f * log10f(FX_TAIL_THRESHOLD) / 60.f;
+	return fminf(FX_TAIL_MAX_SECONDS, _ipdel + 0.257f + rt * decays);
+}
+
 void ZitaReverb::set_ducking(float d) {
 }
 
@@ -565,4 +652,11 @@ void ZitaReverb::reset() {
 		_filt1[i].reset();
 		_delay[i].reset();
 	}
+
+	_half_phase = false;
+	for (int channel = 0; channel < 2; ++channel) {
+		_half_input[channel] = 0.f;
+		_half_prev[channel]  = 0.f;
+		_half_next[channel]  = 0.f;
+	}
 }
\ No newline at end of file
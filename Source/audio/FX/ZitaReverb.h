@@ -38,6 +38,8 @@ private:
 	void init(int size, float c);
 	void fini(void);
 	void reset();
+	// shortens the line within what init() allocated
+	void resize(int size);
 
 	float process(float x) {
 		float z = _line[_i];
@@ -50,7 +52,8 @@ private:
 
 	int _i;
 	float _c;
-	int _size = 0;
+	int _size     = 0;
+	int _capacity = 0;
 	float *_line;
 };
 
@@ -98,6 +101,8 @@ private:
 	void init(int size);
 	void fini(void);
 	void reset();
+	// shortens the line within what init() allocated
+	void resize(int size);
 
 	float read(void) {
 		return _line[_i];
@@ -110,7 +115,8 @@ private:
 	}
 
 	int _i;
-	int _size = 0;
+	int _size     = 0;
+	int _capacity = 0;
 	float *_line;
 };
 
@@ -131,6 +137,8 @@ private:
 	void init(int size);
 	void fini(void);
 	void reset();
+	// shortens the line within what init() allocated, the delay has to be set again
+	void resize(int size);
 	void set_delay(int del);
 
 	float read(void) {
@@ -148,7 +156,8 @@ private:
 
 	int _ir; // read index
 	int _iw; // write index
-	int _size = 0; //delay line size
+	int _size     = 0; //delay line size
+	int _capacity = 0; //allocated size
 	float *_line;
 };
 
@@ -167,6 +176,10 @@ public:
 	void process(float input[2]);
 	void reset();
 
+	// runs the delay network at half the samplerate for real-time use, the eq and the dry signal stay at the full
+	// rate. Nothing is allocated, so this can be switched from the audio thread.
+	void setHalfRate(bool p_half_rate);
+
 	void set_delay(float v);  //v in seconds
 	void set_xover(float v);  // set low freq, v in Hz  
 	void set_rtlow(float v);  //v in seconds (RT60: time for signal to attenuate 60dB)
@@ -179,8 +192,23 @@ public:
 	void set_eq1_freq(float f);
 	void set_ducking(float d); //unused?
 
+	float get_tail_length(void) const; //seconds until the reverb has decayed to silence
+
 private:
-	float _fsamp;
+	// sets up the delay network for _fsamp or half of it
+	void configureRate();
+	void processNetwork(const float input[2], float out[2]);
+
+	float _fsamp = 44100.f;
+	// the rate the delay network runs at
+	float _frate = 44100.f;
+
+	bool _half_rate  = false;
+	bool _half_phase = false;
+	// the first sample of the current pair and the last two network outputs, which are interpolated
+	float _half_input[2] = {0.f, 0.f};
+	float _half_prev[2]  = {0.f, 0.f};
+	float _half_next[2]  = {0.f, 0.f};
 
 	Vdelay _vdelay0;
 	Vdelay _vdelay1;
@@ -0,0 +1,143 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "HalfbandDecimator.h"
+
+#include <cmath>
+#include <cstring>
+
+// 4x to 2x only has to reject what would fold into the passband of the second stage, by about 80 dB
+#define FIRST_STAGE_COEFFICIENTS 4
+#define FIRST_STAGE_TRANSITION 0.14
+// 2x to 1x is flat up to 0.44 of the output rate and rejects more than 110 dB from 0.56 of it on
+#define SECOND_STAGE_COEFFICIENTS 10
+#define SECOND_STAGE_TRANSITION 0.03
+
+// the series converge quickly, the terms are summed until they are negligible
+#define HALFBAND_SERIES_LIMIT 1e-100
+
+static double integerPower(double p_base, int p_exponent) {
+	double result = 1.;
+	for (int i = 0; i < p_exponent; ++i) {
+		result *= p_base;
+	}
+	return result;
+}
+
+void HalfbandDecimator::design(int p_num_coefficients, double p_transition) {
+	jassert(p_num_coefficients > 0 && p_num_coefficients <= HALFBAND_COEFFICIENTS_MAX);
+	m_num_coefficients = p_num_coefficients;
+
+	// elliptic modulus and nome of the transition band
+	double k = tan((1. - p_transition * 2.) * M_PI / 4.);
+	k *= k;
+	const double kk_root = pow(1. - k * k, 0.25);
+	const double e       = 0.5 * (1. - kk_root) / (1. + kk_root);
+	const double e4      = e * e * e * e;
+	const double q       = e * (1. + e4 * (2. + e4 * (15. + 150. * e4)));
+
+	const int order = p_num_coefficients * 2 + 1;
+	for (int index = 0; index < p_num_coefficients; ++index) {
+		const int c = index + 1;
+
+		double numerator = 0.;
+		double term      = 0.;
+		int sign         = 1;
+		for (int i = 0; i == 0 || fabs(term) > HALFBAND_SERIES_LIMIT; ++i) {
+			term = integerPower(q, i * (i + 1)) * sin((i * 2 + 1) * c * M_PI / order) * sign;
+			numerator += term;
+			sign = -sign;
+		}
+		numerator *= pow(q, 0.25);
+
+		double denominator = 0.5;
+		sign               = -1;
+		for (int i = 1; i == 1 || fabs(term) > HALFBAND_SERIES_LIMIT; ++i) {
+			term = integerPower(q, i * i) * cos(i * 2 * c * M_PI / order) * sign;
+			denominator += term;
+			sign = -sign;
+		}
+
+		const double ww         = numerator / denominator;
+		const double ww_squared = ww * ww;
+		const double x          = sqrt((1. - ww_squared * k) * (1. - ww_squared / k)) / (1. + ww_squared);
+		m_coefficients[index]   = (1. - x) / (1. + x);
+	}
+	reset();
+}
+
+void HalfbandDecimator::process(const float *p_input, float *p_output, int p_num_output) {
+	for (int sample = 0; sample < p_num_output; ++sample) {
+		// even coefficients filter the newer sample of each pair, odd ones the older
+		double path[2] = {p_input[2 * sample + 1], p_input[2 * sample]};
+		for (int index = 0; index < m_num_coefficients; ++index) {
+			double &value      = path[index & 1];
+			const double x_old = m_x[index];
+			m_x[index]         = value;
+			value              = (value - m_y[index]) * m_coefficients[index] + x_old;
+			m_y[index]         = value;
+		}
+		p_output[sample] = (float)(0.5 * (path[0] + path[1]));
+	}
+}
+
+void HalfbandDecimator::reset() {
+	for (int index = 0; index < HALFBAND_COEFFICIENTS_MAX; ++index) {
+		m_x[index] = 0.;
+		m_y[index] = 0.;
+	}
+}
+
+VoiceDecimator::VoiceDecimator() {
+	for (int channel = 0; channel < 2; ++channel) {
+		m_first_stage[channel].design(FIRST_STAGE_COEFFICIENTS, FIRST_STAGE_TRANSITION);
+		m_second_stage[channel].design(SECOND_STAGE_COEFFICIENTS, SECOND_STAGE_TRANSITION);
+	}
+}
+
+void VoiceDecimator::setFactor(int p_factor) {
+	jassert(p_factor == 1 || p_factor == 2 || p_factor == VOICE_OVERSAMPLING_MAX);
+	m_factor = p_factor;
+	reset();
+}
+
+void VoiceDecimator::process(
+    const float *p_input_left, const float *p_input_right, float *p_left, float *p_right, int p_num_output) {
+	jassert(p_num_output <= SUB_BLOCK_SIZE_MAX);
+
+	const float *input[2] = {p_input_left, p_input_right};
+	float *output[2]      = {p_left, p_right};
+	for (int channel = 0; channel < 2; ++channel) {
+		switch (m_factor) {
+		case 1:
+			memcpy(output[channel], input[channel], sizeof(float) * p_num_output);
+			break;
+		case 2:
+			m_second_stage[channel].process(input[channel], output[channel], p_num_output);
+			break;
+		default:
+			m_first_stage[channel].process(input[channel], m_stage_buffer[channel], p_num_output * 2);
+			m_second_stage[channel].process(m_stage_buffer[channel], output[channel], p_num_output);
+			break;
+		}
+	}
+}
+
+void VoiceDecimator::reset() {
+	for (int channel = 0; channel < 2; ++channel) {
+		m_first_stage[channel].reset();
+		m_second_stage[channel].reset();
+	}
+}
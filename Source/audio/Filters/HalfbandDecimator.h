@@ -0,0 +1,68 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+// The filter design follows Laurent de Soras' HIIR library, find out more on http://ldesoras.free.fr
+
+#pragma once
+
+#include "../../GlobalIncludes.h"
+
+#define HALFBAND_COEFFICIENTS_MAX 10
+
+/**
+ * Decimates by two with a polyphase IIR half-band filter: two chains of first order allpasses, one for the even and
+ * one for the odd input samples, which both run at the output rate. The coefficients are those of an elliptic
+ * half-band lowpass, p_transition is the width of the transition band on either side of a quarter of the input rate.
+ */
+class HalfbandDecimator {
+public:
+	void design(int p_num_coefficients, double p_transition);
+
+	// p_input holds 2 * p_num_output samples
+	void process(const float *p_input, float *p_output, int p_num_output);
+
+	void reset();
+
+private:
+	double m_coefficients[HALFBAND_COEFFICIENTS_MAX] = {0.};
+	int m_num_coefficients                           = 0;
+	double m_x[HALFBAND_COEFFICIENTS_MAX]            = {0.};
+	double m_y[HALFBAND_COEFFICIENTS_MAX]            = {0.};
+};
+
+/**
+ * Brings the stereo voice sum from 1x, 2x or 4x the host rate back down to it. 4x is decimated in two half-band
+ * stages, the first of which only has to keep what would fold into the passband of the second and gets by with a
+ * much shorter filter.
+ */
+class VoiceDecimator {
+public:
+	VoiceDecimator();
+
+	// resets the filters, the factor is 1, 2 or VOICE_OVERSAMPLING_MAX
+	void setFactor(int p_factor);
+
+	// p_input holds p_num_output * factor samples per channel, p_num_output is at most SUB_BLOCK_SIZE_MAX
+	void process(const float *p_input_left, const float *p_input_right, float *p_left, float *p_right, int p_num_output);
+
+	void reset();
+
+private:
+	int m_factor = 1;
+	// [channel], the first stage goes from 4x to 2x, the second one from 2x to 1x
+	HalfbandDecimator m_first_stage[2];
+	HalfbandDecimator m_second_stage[2];
+	float m_stage_buffer[2][SUB_BLOCK_SIZE_MAX * 2] = {{0.f}};
+};
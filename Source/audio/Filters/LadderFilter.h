@@ -64,6 +64,7 @@ public:
       return;
     }
     m_last_freq_modded = m_freq_modded;
+    ++m_coefficient_version;
 
 
     m_k_modded = m_k + 4 * (*m_res_mod);
@@ -196,6 +197,8 @@ public:
   FILTERTYPE m_filter_type = FILTERTYPE::LP4;
 
   double m_last_freq_modded = -1;
+  // counts coefficient recalculations, so LadderFilterLanes knows when to fetch new ones
+  unsigned int m_coefficient_version = 0;
 
   // variables
   double m_k; // K, set with Q
@@ -0,0 +1,135 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../VoiceLanes.h"
+#include "LadderFilter.h"
+
+/**
+ * Runs the ladder filters of up to VOICE_LANES voices side by side. The integrator states and coefficients are
+ * taken over from the LadderFilter objects with load() and live in lanes until they are handed back with store().
+ * The filters themselves still do the modulation and coefficient calculation in update(), syncCoefficients()
+ * only copies new coefficients over when a filter recalculated them.
+ * The four one pole stages of a ladder are plain lowpasses (no pre gain, no feedback path), which is what is
+ * computed here. The overdrive is left to the caller, since it depends on per voice modulation.
+ */
+class LadderFilterLanes {
+public:
+	// takes over the filters, lanes with a nullptr stay silent
+	void load(LadderFilter *const *p_filters) {
+		for (int lane = 0; lane < VOICE_LANES; ++lane) {
+			m_filter[lane] = p_filters[lane];
+			if (m_filter[lane]) {
+				m_z[0][lane] = m_filter[lane]->m_LPF1.m_z_1;
+				m_z[1][lane] = m_filter[lane]->m_LPF2.m_z_1;
+				m_z[2][lane] = m_filter[lane]->m_LPF3.m_z_1;
+				m_z[3][lane] = m_filter[lane]->m_LPF4.m_z_1;
+				fetchCoefficients(lane);
+			} else {
+				for (int pole = 0; pole < 4; ++pole) {
+					m_z[pole][lane]    = 0.0;
+					m_beta[pole][lane] = 0.0;
+				}
+				m_G[lane] = m_k[lane] = m_alpha_0[lane] = 0.0;
+				m_a[lane] = m_b[lane] = m_c[lane] = m_d[lane] = m_e[lane] = 0.0;
+			}
+		}
+	}
+
+	// hands the integrator states of a lane back to its filter
+	void store(int p_lane) {
+		if (m_filter[p_lane]) {
+			m_filter[p_lane]->m_LPF1.m_z_1 = m_z[0][p_lane];
+			m_filter[p_lane]->m_LPF2.m_z_1 = m_z[1][p_lane];
+			m_filter[p_lane]->m_LPF3.m_z_1 = m_z[2][p_lane];
+			m_filter[p_lane]->m_LPF4.m_z_1 = m_z[3][p_lane];
+		}
+	}
+
+	// call after the filter of the lane ran update()
+	inline void syncCoefficients(int p_lane) {
+		if (m_filter[p_lane]->m_coefficient_version != m_version[p_lane]) {
+			fetchCoefficients(p_lane);
+		}
+	}
+
+	// p_input and p_output hold one sample per lane and need to be aligned to 32 bytes
+	inline void doFilter(const double *p_input, double *p_output) {
+		const VoiceLaneVector G  = VoiceLaneVector::load(m_G);
+		const VoiceLaneVector z1 = VoiceLaneVector::load(m_z[0]);
+		const VoiceLaneVector z2 = VoiceLaneVector::load(m_z[1]);
+		const VoiceLaneVector z3 = VoiceLaneVector::load(m_z[2]);
+		const VoiceLaneVector z4 = VoiceLaneVector::load(m_z[3]);
+
+		const VoiceLaneVector sigma = VoiceLaneVector::load(m_beta[0]) * z1 + VoiceLaneVector::load(m_beta[1]) * z2 +
+		                              VoiceLaneVector::load(m_beta[2]) * z3 + VoiceLaneVector::load(m_beta[3]) * z4;
+
+		// input to first filter
+		const VoiceLaneVector u =
+		    (VoiceLaneVector::load(p_input) - VoiceLaneVector::load(m_k) * sigma) * VoiceLaneVector::load(m_alpha_0);
+
+		// cascade of 4 one pole lowpasses
+		const VoiceLaneVector v1  = (u - z1) * G;
+		const VoiceLaneVector lp1 = v1 + z1;
+		(v1 + lp1).store(m_z[0]);
+		const VoiceLaneVector v2  = (lp1 - z2) * G;
+		const VoiceLaneVector lp2 = v2 + z2;
+		(v2 + lp2).store(m_z[1]);
+		const VoiceLaneVector v3  = (lp2 - z3) * G;
+		const VoiceLaneVector lp3 = v3 + z3;
+		(v3 + lp3).store(m_z[2]);
+		const VoiceLaneVector v4  = (lp3 - z4) * G;
+		const VoiceLaneVector lp4 = v4 + z4;
+		(v4 + lp4).store(m_z[3]);
+
+		// Oberheim variations
+		(VoiceLaneVector::load(m_a) * u + VoiceLaneVector::load(m_b) * lp1 + VoiceLaneVector::load(m_c) * lp2 +
+		 VoiceLaneVector::load(m_d) * lp3 + VoiceLaneVector::load(m_e) * lp4)
+		    .store(p_output);
+	}
+
+private:
+	void fetchCoefficients(int p_lane) {
+		const LadderFilter &filter = *m_filter[p_lane];
+		m_version[p_lane]          = filter.m_coefficient_version;
+		m_G[p_lane]                = filter.m_LPF1.m_alpha;
+		m_beta[0][p_lane]          = filter.m_LPF1.m_beta;
+		m_beta[1][p_lane]          = filter.m_LPF2.m_beta;
+		m_beta[2][p_lane]          = filter.m_LPF3.m_beta;
+		m_beta[3][p_lane]          = filter.m_LPF4.m_beta;
+		m_k[p_lane]                = filter.m_k_modded;
+		m_alpha_0[p_lane]          = filter.m_alpha_0;
+		m_a[p_lane]                = filter.m_a;
+		m_b[p_lane]                = filter.m_b;
+		m_c[p_lane]                = filter.m_c;
+		m_d[p_lane]                = filter.m_d;
+		m_e[p_lane]                = filter.m_e;
+	}
+
+	LadderFilter *m_filter[VOICE_LANES] = {nullptr};
+	unsigned int m_version[VOICE_LANES] = {0};
+
+	alignas(32) double m_z[4][VOICE_LANES];
+	alignas(32) double m_beta[4][VOICE_LANES];
+	alignas(32) double m_G[VOICE_LANES];
+	alignas(32) double m_k[VOICE_LANES];
+	alignas(32) double m_alpha_0[VOICE_LANES];
+	alignas(32) double m_a[VOICE_LANES];
+	alignas(32) double m_b[VOICE_LANES];
+	alignas(32) double m_c[VOICE_LANES];
+	alignas(32) double m_d[VOICE_LANES];
+	alignas(32) double m_e[VOICE_LANES];
+};
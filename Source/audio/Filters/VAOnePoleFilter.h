@@ -60,6 +60,8 @@ public:
 	double m_a_0;      // input gain
 	double m_feedback; // our own feedback coeff from S
 protected:
+	// the lane renderer keeps the integrator state of several voices in registers
+	friend class LadderFilterLanes;
 
 	bool m_is_lowpass = true; //else highpass
 	double m_z_1;             // our z-1 storage location
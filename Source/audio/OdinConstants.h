@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <cmath>
+
 #define SUBTABLES_PER_WAVETABLE 33 //there are 40 tables for one "sound"
 
 #define NUMBER_OF_WAVETABLES 160  //number of different 1D WTs
@@ -27,6 +29,7 @@
 //#define SPECDRAW_LENGTH 100
 #define NUMBER_OF_HARMONICS 256 //maximum harmonics used (Wavetable length is 512 -> nyquist -> 256)
 #define WAVETABLE_LENGTH 512 //how long the actual wavetable is
+#define WAVETABLE_FFT_ORDER 9 //2^9 = WAVETABLE_LENGTH
 #define MAX_EXPECTED_SAMPLE_RATE 192000 //use this for calculation of Delaylength
 #define MAX_DELAY_TIME 4//max delay time at max samplerate in seconds
 
@@ -34,3 +37,18 @@
 #define NUMBER_OF_WAVETABLES_2D 40
 #define TABLES_PER_2D_WT 4
 #define PI 3.1415926535897932384626433832795
+
+#define FX_TAIL_THRESHOLD 0.00001f // -100dB, an fx tail below this counts as silence
+#define FX_TAIL_MAX_SECONDS 60.f // feedback close to 1 rings (almost) forever, so tails are capped here
+
+// seconds until a feedback loop with a round trip time of p_loop_time has decayed below FX_TAIL_THRESHOLD
+inline float feedbackTailLength(float p_loop_time, float p_feedback) {
+	p_feedback = std::fabs(p_feedback);
+	if (p_feedback <= FX_TAIL_THRESHOLD) {
+		return p_loop_time;
+	}
+	if (p_feedback >= 1.f) {
+		return FX_TAIL_MAX_SECONDS;
+	}
+	return std::fmin(FX_TAIL_MAX_SECONDS, p_loop_time * (1.f + std::log(FX_TAIL_THRESHOLD) / std::log(p_feedback)));
+}
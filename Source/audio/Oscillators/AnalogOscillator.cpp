@@ -63,9 +63,9 @@ float AnalogOscillator::doOscillate() {
 float AnalogOscillator::doSquare() {
 	// square is done by subtracting two saw waves
 	// prepare both sides and interpol value for base and offset value
-	m_duty_smooth = m_duty_smooth * PWM_SMOOTHIN_FACTOR + (1 - PWM_SMOOTHIN_FACTOR) * (m_duty);
+	m_duty_smooth.setTarget(m_duty);
 
-	float duty_modded = (m_duty_smooth + (*pwm_mod) / 2);
+	float duty_modded = (m_duty_smooth.next() + (*pwm_mod) / 2);
 
 	double read_index_offset = m_read_index + duty_modded * WAVETABLE_LENGTH;
 	checkWrapIndex(read_index_offset);
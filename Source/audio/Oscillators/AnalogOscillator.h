@@ -16,6 +16,7 @@
 #pragma once
 #include "WavetableOsc1D.h"
 #include "DriftGenerator.h"
+#include "../ParameterSmoother.h"
 
 #define DRIFT_RANGE_SEMITONES 0.2f;
 
@@ -44,7 +45,7 @@ public:
 	}
 
 	void setSmoothValues(){
-		m_duty_smooth = m_duty;
+		m_duty_smooth.reset(m_duty);
 	}
 
 	void setSampleRate(float p_sr) override {
@@ -52,6 +53,11 @@ public:
 		m_drift_generator.setSampleRate(p_sr);
 	}
 
+	void seedRandom(uint32_t p_seed) override {
+		WavetableOsc1D::seedRandom(p_seed);
+		m_drift_generator.seedRandom(~p_seed);
+	}
+
 protected:
 
 	float* pwm_mod;
@@ -64,6 +70,6 @@ protected:
 	float m_smoothed_drift_noise = 0.f;
 	float m_drift = 0.f;
 	float m_duty = 0.5f;
-	float m_duty_smooth = 0.5f;
+	ParameterSmoother m_duty_smooth{PWM_SMOOTHIN_FACTOR, 0.5f};
 };
 
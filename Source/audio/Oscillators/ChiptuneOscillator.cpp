@@ -14,15 +14,11 @@
 */
 
 #include "ChiptuneOscillator.h"
-#include <ctime>
 
 #define NOISE_SEGMENT_LENGTH 30
 
 ChiptuneOscillator::ChiptuneOscillator() {
 	m_nr_of_wavetables = NUMBER_OF_WAVETABLES + 9; //+9 for draw tables
-
-	// seed random
-	std::srand(std::time(nullptr));
 }
 
 ChiptuneOscillator::~ChiptuneOscillator() {
@@ -44,7 +40,7 @@ float ChiptuneOscillator::generateChipNoise() {
 	m_read_index += m_wavetable_inc;
 	if (m_read_index > NOISE_SEGMENT_LENGTH * 3) {
 		m_read_index       = 0.f;
-		m_last_noise_value = std::rand() % 16 - 8;
+		m_last_noise_value = (int)(m_random.nextInt() >> 28) - 8;
 		m_last_noise_value *= 0.125f;
 	}
 
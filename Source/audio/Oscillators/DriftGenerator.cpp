@@ -15,7 +15,6 @@
 
 #include "DriftGenerator.h"
 #include "../../GlobalIncludes.h"
-#include "stdlib.h"
 
 DriftGenerator::DriftGenerator() {
 }
@@ -55,6 +54,5 @@ void DriftGenerator::calcNewCoeffs() {
 }
 
 float DriftGenerator::getRand() {
-	float random = (float)rand();
-	return 2.f * ((float)random / (float)RAND_MAX) - 1.f;
+	return m_random.nextBipolar();
 }
@@ -15,6 +15,7 @@
 
 #pragma once
 #include "../JuceLibraryCode/JuceHeader.h"
+#include "../RandomGenerator.h"
 
 #define DRIFT_LENGTH_SECONDS 5
 
@@ -28,6 +29,9 @@ public:
 	float doDrift();
 	void initialize(float p_samplerate);
 	void setSampleRate(float p_samplerate);
+	void seedRandom(uint32_t p_seed) {
+		m_random.seed(p_seed);
+	}
 protected:
 
 	float getRand();
@@ -43,5 +47,7 @@ protected:
 
 	float m_samplerate = -1;
 	float m_one_over_samplerate;
+
+	RandomGenerator m_random;
 };
 
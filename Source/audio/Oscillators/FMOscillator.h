@@ -37,6 +37,11 @@ public:
 		m_modulator_osc.randomizePhase();
 	}
 
+	void seedRandom(uint32_t p_seed) override {
+		m_carrier_osc.seedRandom(p_seed);
+		m_modulator_osc.seedRandom(~p_seed);
+	}
+
 	inline void setFMAmount(float p_fm_amount){
 		m_FM_amount = p_fm_amount;
 	}
@@ -85,6 +90,11 @@ public:
 		m_modulator_osc.setSampleRate(p_sr);
 	}
 
+	void setCubicInterpolation(bool p_cubic){
+		m_carrier_osc.setCubicInterpolation(p_cubic);
+		m_modulator_osc.setCubicInterpolation(p_cubic);
+	}
+
 	void setFMModPointer(float* p_pointer){
 		m_fm_mod = p_pointer;
 	}
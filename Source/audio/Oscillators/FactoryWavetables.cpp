@@ -0,0 +1,92 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "FactoryWavetables.h"
+#include "Wavetables/Tables/LFOTableData.h"
+#if ODIN2_WAVETABLE_RESOURCE
+#include "WavetableResource.h"
+#include "WavetableResourceData.h"
+#else
+#include "Wavetables/Tables/WavetableData.h"
+#endif
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+FactoryWavetables::FactoryWavetables() {
+#include "WavetableCoefficients.h"
+
+#if ODIN2_WAVETABLE_RESOURCE
+	const float *tables = WavetableResource::getTablesInPlace(WavetableResourceData::wavetables_bin,
+	                                                          (size_t)WavetableResourceData::wavetables_binSize);
+	if (tables == nullptr) {
+		m_decoded_tables.calloc(WAVETABLE_RESOURCE_NUM_SAMPLES);
+		if (!WavetableResource::read(WavetableResourceData::wavetables_bin,
+		                             (size_t)WavetableResourceData::wavetables_binSize,
+		                             m_decoded_tables)) {
+			// the tables stay silent, odin2-wavetables has to write the resource again
+			jassertfalse;
+		}
+		tables = m_decoded_tables;
+	}
+#endif
+
+	// the tables are not copied, only the pointers to them are set up here
+	for (int index_wavetable = 0; index_wavetable < NUMBER_OF_WAVETABLES; ++index_wavetable) {
+		for (int index_subtable = 0; index_subtable < SUBTABLES_PER_WAVETABLE; ++index_subtable) {
+#if ODIN2_WAVETABLE_RESOURCE
+			m_wavetable_pointers[index_wavetable][index_subtable] =
+			    tables + (index_wavetable * SUBTABLES_PER_WAVETABLE + index_subtable) * WAVETABLE_LENGTH;
+#else
+			m_wavetable_pointers[index_wavetable][index_subtable] = getOneSubTable(index_wavetable, index_subtable);
+#endif
+		}
+		m_name_index_map.insert(std::pair<std::string, int>(m_wavetable_names_1D[index_wavetable], index_wavetable));
+	}
+
+	for (int index_wavetable = 0; index_wavetable < NUMBER_OF_LFOTABLES; ++index_wavetable) {
+		m_LFO_pointers[index_wavetable][0] = getOneLFOTable(index_wavetable);
+		m_LFO_name_index_map.insert(std::pair<std::string, int>(m_LFO_names[index_wavetable], index_wavetable));
+	}
+}
+
+const float **FactoryWavetables::getWavetablePointers(int p_wavetable) {
+	return m_wavetable_pointers[p_wavetable];
+}
+
+const float **FactoryWavetables::getWavetablePointers(const std::string &p_name) {
+	auto it = m_name_index_map.find(p_name);
+	if (it != m_name_index_map.end()) {
+		return m_wavetable_pointers[it->second];
+	}
+	return m_wavetable_pointers[0]; // return sine if no wt found
+}
+
+const float **FactoryWavetables::getLFOPointers(const std::string &p_name) {
+	auto it = m_LFO_name_index_map.find(p_name);
+	if (it != m_LFO_name_index_map.end()) {
+		return m_LFO_pointers[it->second];
+	}
+	DBG("Couldn't find LFO table " + p_name);
+	return m_LFO_pointers[0];
+}
+
+int FactoryWavetables::getWavetableIndexFromName(const std::string &p_name) const {
+	auto it = m_name_index_map.find(p_name);
+	if (it != m_name_index_map.end()) {
+		return it->second;
+	}
+	DBG("getWavetableIndexFromName(): COULDNT FIND WT WITH NAME " + p_name);
+	return 0;
+}
@@ -0,0 +1,52 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../../GlobalIncludes.h"
+#include "../OdinConstants.h"
+#include "../JuceLibraryCode/JuceHeader.h"
+#include <map>
+#include <string>
+
+/**
+ * The factory wavetables and LFO tables with their names. They never change, so all plugin instances in a process
+ * share one FactoryWavetables through a SharedResourcePointer, which builds it for the first instance and deletes it
+ * with the last one. Everything is set up in the constructor, afterwards it is only read, from any thread.
+ * The tables come from WavetableData.cpp, or with ODIN2_WAVETABLE_RESOURCE from the embedded WavetableResource.
+ */
+class FactoryWavetables {
+public:
+	FactoryWavetables();
+
+	const float **getWavetablePointers(int p_wavetable);
+	// the sine table if there is no table called p_name
+	const float **getWavetablePointers(const std::string &p_name);
+	const float **getLFOPointers(const std::string &p_name);
+	int getWavetableIndexFromName(const std::string &p_name) const;
+
+private:
+	const float *m_wavetable_pointers[NUMBER_OF_WAVETABLES][SUBTABLES_PER_WAVETABLE];
+	const float *m_LFO_pointers[NUMBER_OF_LFOTABLES][1];
+	// int16 and half resources are decoded into this, float ones are used in place
+	HeapBlock<float> m_decoded_tables;
+
+	std::map<std::string, int> m_name_index_map;
+	std::map<std::string, int> m_LFO_name_index_map;
+
+	// filled by the coefficient headers
+	std::string m_wavetable_names_1D[NUMBER_OF_WAVETABLES];
+	std::string m_LFO_names[NUMBER_OF_LFOTABLES];
+};
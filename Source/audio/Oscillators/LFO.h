@@ -58,8 +58,7 @@ public:
 	}
 
 	float getBipolarRandom() {
-		float white_noise = (float)rand();
-		return 2 * (white_noise / RAND_MAX) - 1;
+		return m_random.nextBipolar();
 	}
 
 	float doSampleHold();
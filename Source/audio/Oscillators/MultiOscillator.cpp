@@ -69,7 +69,9 @@ void MultiOscillator::update() {
 	int table_index = getTableIndex(m_oscillator_freq_multi[0]);
 
 	for (int osc = 0; osc < OSCS_PER_MULTIOSC; ++osc) {
-		m_current_table_2D_multi[osc] = m_wavetable_pointers_2D[m_wavetable_index][table_index];
+		for (int table = 0; table < TABLES_PER_2D_WT; ++table) {
+			m_current_table_2D_multi[osc][table] = m_wavetable_pointers_2D[m_wavetable_index][table][table_index];
+		}
 	}
 }
 
@@ -31,7 +31,7 @@ public:
 
 	void randomizePhase() override {
 		for(int osc = 0; osc < OSCS_PER_MULTIOSC; ++osc){
-	  		m_read_index_multi[osc] = (float)rand() / (float)RAND_MAX * WAVETABLE_LENGTH;
+	  		m_read_index_multi[osc] = m_random.nextFloat() * WAVETABLE_LENGTH;
 		}
 	}
 
@@ -100,7 +100,7 @@ protected:
 	float m_oscillator_freq_multi[OSCS_PER_MULTIOSC];
 	float m_wavetable_inc_multi[OSCS_PER_MULTIOSC];
 	int m_sub_table_index_multi[OSCS_PER_MULTIOSC];
-	const float** m_current_table_2D_multi[OSCS_PER_MULTIOSC];
+	const float *m_current_table_2D_multi[OSCS_PER_MULTIOSC][TABLES_PER_2D_WT];
 
 	//#include "PitchShiftTable.h" //contains 1000 points of pitch shift table for -5 to +5
 };
@@ -35,8 +35,7 @@ float NoiseOscillator::doNoise() {
 	m_lowpass.update();
 	m_highpass.update();
 
-	float white_noise = (float)rand();
-	white_noise       = 2 * (white_noise / RAND_MAX) - 1;
+	float white_noise = m_random.nextBipolar();
 
 	// do 2nd order like this?
 	white_noise = m_lowpass.doFilter(white_noise);
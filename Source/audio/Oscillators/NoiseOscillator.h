@@ -16,6 +16,7 @@
 #pragma once
 
 #include "../Filters/VAOnePoleFilter.h"
+#include "../RandomGenerator.h"
 
 class NoiseOscillator
 {
@@ -25,6 +26,10 @@ public:
 
 	float doNoise();   
 
+	void seedRandom(uint32_t p_seed) {
+		m_random.seed(p_seed);
+	}
+
 	void setFilterFreqs(float p_lowpass_freq, float p_highpass_freq);
 	void setHPFreq(float p_freq);
 	void setLPFreq(float p_freq);
@@ -61,5 +66,6 @@ protected:
 
 	VAOnePoleFilter m_lowpass;
 	VAOnePoleFilter m_highpass;
+	RandomGenerator m_random;
 };
 
@@ -16,6 +16,7 @@
 #pragma once
 #include "../JuceLibraryCode/JuceHeader.h"
 #include "../../GlobalIncludes.h"
+#include "../RandomGenerator.h"
 #include <cmath>
 
 #define OSC_FO_MOD_RANGE 2          // 2 semitone default
@@ -75,6 +76,10 @@ public:
 	static float pitchShiftMultiplier(float p_semitones);
 	virtual float doOscillate() = 0;
 	virtual void randomizePhase() = 0;
+	// oscillators which hold other oscillators or random modules seed them as well
+	virtual void seedRandom(uint32_t p_seed) {
+		m_random.seed(p_seed);
+	}
 	virtual void setSampleRate(float p_samplerate);
 	virtual void setGlideTargetFrequency(float p_freq);
 	virtual void setBaseFrequency(float p_freq);
@@ -120,4 +125,6 @@ protected:
 
 	float *m_unison_detune_factor_pointer = nullptr;
 	float unison_detune_factor_dummy      = 1.f;
+
+	RandomGenerator m_random;
 };
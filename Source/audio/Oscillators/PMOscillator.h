@@ -36,12 +36,22 @@ public:
     m_carrier_osc.randomizePhase();
 	}
 
+  void seedRandom(uint32_t p_seed) override {
+    m_carrier_osc.seedRandom(p_seed);
+    m_modulator_osc.seedRandom(~p_seed);
+  }
+
   void setSampleRate(float p_sr) override {
 	  Oscillator::setSampleRate(p_sr);
 	  m_carrier_osc.setSampleRate(p_sr);
 	  m_modulator_osc.setSampleRate(p_sr);
   }
 
+  // the carrier reads its table at the phase modulated position and stays linear
+  void setCubicInterpolation(bool p_cubic){
+    m_modulator_osc.setCubicInterpolation(p_cubic);
+  }
+
   void setWavetableContainer(WavetableContainer* p_WT_container){
     m_carrier_osc.setWavetableContainer(p_WT_container);
     m_modulator_osc.setWavetableContainer(p_WT_container);
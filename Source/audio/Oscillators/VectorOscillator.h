@@ -15,6 +15,7 @@
 
 #pragma once
 #include "WavetableOsc1D.h"
+#include "../ParameterSmoother.h"
 
 #define VECTOR_EDGES 4
 
@@ -26,15 +27,15 @@ public:
   void setBaseFrequency(float p_freq) override {
     WavetableOsc1D::setBaseFrequency(p_freq);
     // this means osc-restart so we will set pos_smooth to pos here (= hack)
-    m_XY_pad_x_smooth = m_XY_pad_x;
-    m_XY_pad_y_smooth = m_XY_pad_y;
+    m_XY_pad_x_smooth.reset(m_XY_pad_x);
+    m_XY_pad_y_smooth.reset(m_XY_pad_y);
   }
 
   void reset() override {
     WavetableOsc1D::reset();
 
-    m_XY_pad_x_smooth = m_XY_pad_x;
-    m_XY_pad_y_smooth = m_XY_pad_y;
+    m_XY_pad_x_smooth.reset(m_XY_pad_x);
+    m_XY_pad_y_smooth.reset(m_XY_pad_y);
   }
 
   inline void setXYPad(float p_x, float p_y) {
@@ -67,8 +68,8 @@ protected:
   float m_XY_pad_x = 0.f;
   float m_XY_pad_y = 0.f;
 
-  float m_XY_pad_x_smooth = 0.f;
-  float m_XY_pad_y_smooth = 0.f;
+  ParameterSmoother m_XY_pad_x_smooth{0.999f, 0.f};
+  ParameterSmoother m_XY_pad_y_smooth{0.999f, 0.f};
 
   const float *m_current_table_vec[VECTOR_EDGES];
   int m_wavetable_index[VECTOR_EDGES];
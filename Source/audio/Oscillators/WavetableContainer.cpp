@@ -23,37 +23,40 @@
 
 #include "../JuceLibraryCode/JuceHeader.h"
 
-WavetableContainer::WavetableContainer() {
-//#ifdef ODIN_DEBUG
-#include "WavetableCoefficients.h"
-//#endif
-
-	// dynamically allocate wavetables
-	// m_wavetables = new
-	// float[NUMBER_OF_WAVETABLES][SUBTABLES_PER_WAVETABLE][WAVETABLE_LENGTH];
-	m_wavetables = new float **[NUMBER_OF_WAVETABLES];
-	for (int table = 0; table < NUMBER_OF_WAVETABLES; ++table) {
-		m_wavetables[table] = new float *[SUBTABLES_PER_WAVETABLE];
-		for (int sub = 0; sub < SUBTABLES_PER_WAVETABLE; ++sub) {
-			m_wavetables[table][sub] = new float[WAVETABLE_LENGTH];
-		}
-	}
+// wavedraw has the most drawn values
+#define DRAWN_STEPS_MAX WAVEDRAW_STEPS_X
 
+WavetableContainer::WavetableContainer() {
 	// create specdraw scalar
 	for (int harmonic = 1; harmonic < SPECDRAW_STEPS_X + 1; ++harmonic) {
 		m_specdraw_scalar[harmonic - 1] = 1.f / sqrtf((float)harmonic);
 	}
-}
 
-WavetableContainer::~WavetableContainer() {
-	// delete wavetables
-	for (int table = 0; table < NUMBER_OF_WAVETABLES; ++table) {
+	// the oscillators keep the pointers, new tables are copied into the arrays behind them
+	for (int table = 0; table < NUMBER_OF_WAVEDRAW_TABLES; ++table) {
+		m_draw_live[table] = m_wavedraw_tables[table];
+		for (int sub = 0; sub < SUBTABLES_PER_WAVETABLE; ++sub) {
+			m_wavedraw_pointers[table][sub] = m_wavedraw_tables[table][sub];
+		}
+	}
+	for (int table = 0; table < NUMBER_OF_CHIPDRAW_TABLES; ++table) {
+		m_draw_live[NUMBER_OF_WAVEDRAW_TABLES + table] = m_chipdraw_tables[table];
 		for (int sub = 0; sub < SUBTABLES_PER_WAVETABLE; ++sub) {
-			delete[] m_wavetables[table][sub];
+			m_chipdraw_pointers[table][sub] = m_chipdraw_tables[table][sub];
 		}
-		delete[] m_wavetables[table];
 	}
-	delete[] m_wavetables;
+	for (int table = 0; table < NUMBER_OF_SPECDRAW_TABLES; ++table) {
+		m_draw_live[NUMBER_OF_WAVEDRAW_TABLES + NUMBER_OF_CHIPDRAW_TABLES + table] = m_specdraw_tables[table];
+		for (int sub = 0; sub < SUBTABLES_PER_WAVETABLE; ++sub) {
+			m_specdraw_pointers[table][sub] = m_specdraw_tables[table][sub];
+		}
+	}
+	for (int table = 0; table < DRAW_TABLES; ++table) {
+		m_draw_staging_state[table].store(StagingIdle);
+	}
+}
+
+WavetableContainer::~WavetableContainer() {
 }
 /*
 void WavetableContainer::createWavetables(float p_samplerate) {
@@ -185,216 +188,141 @@ void WavetableContainer::createLFOtables(float p_samplerate) {
 void WavetableContainer::createChipdrawTable(int p_table_nr,
                                              float p_chipdraw_values[CHIPDRAW_STEPS_X],
                                              float p_samplerate) {
-
-	// first generate the fourier coefficients
 	float chipdraw_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS];
-
-	float step_width = 2 * PI / CHIPDRAW_STEPS_X;
-
-	for (int harmonic = 1; harmonic < NUMBER_OF_HARMONICS; ++harmonic) {
-
-		float coeff_sine   = 0.f;
-		float coeff_cosine = 0.f;
-
-		for (int segment = 0; segment < CHIPDRAW_STEPS_X; ++segment) {
-			coeff_sine += const_segment_one_overtone_sine(
-			    segment * step_width, (segment + 1) * step_width, p_chipdraw_values[segment], harmonic);
-			coeff_cosine += const_segment_one_overtone_cosine(
-			    segment * step_width, (segment + 1) * step_width, p_chipdraw_values[segment], harmonic);
-		}
-		chipdraw_coefficients[0][harmonic] = coeff_sine;
-		chipdraw_coefficients[1][harmonic] = coeff_cosine;
-	}
-
-	// now create the wavetable from the fourier coefficients
-	double seed_freq = 27.5; // A0
-	float max        = 0.f;
-
-	// delete old table
-	memset(m_chipdraw_tables[p_table_nr], 0, SUBTABLES_PER_WAVETABLE * WAVETABLE_LENGTH * sizeof(float));
-
-	// loop over subtables
-	for (int index_sub_table = 0; index_sub_table < SUBTABLES_PER_WAVETABLE; ++index_sub_table) {
-
-		// how many harmonics are needed for this subtable
-		int number_of_harmonics = (int)((p_samplerate * 0.5f / seed_freq) - 1);
-
-		// don't allow more than 256 harmonics (for big Samplerates this might
-		// happen)
-		number_of_harmonics = number_of_harmonics > NUMBER_OF_HARMONICS ? NUMBER_OF_HARMONICS : number_of_harmonics;
-
-		for (int index_position = 0; index_position < WAVETABLE_LENGTH; ++index_position) {
-			for (int index_harmonics = 1; index_harmonics < number_of_harmonics; ++index_harmonics) {
-
-				// fill table with
-				// sine harmonics
-				m_chipdraw_tables[p_table_nr][index_sub_table][index_position] +=
-				    chipdraw_coefficients[0][index_harmonics] *
-				    sin(2.f * PI * index_position * index_harmonics / (float)WAVETABLE_LENGTH);
-				// cosine
-				m_chipdraw_tables[p_table_nr][index_sub_table][index_position] +=
-				    chipdraw_coefficients[1][index_harmonics] *
-				    cos(2.f * PI * index_position * index_harmonics / (float)WAVETABLE_LENGTH);
-			}
-			// find max among all tables
-			if (fabs(m_chipdraw_tables[p_table_nr][index_sub_table][index_position]) > max) {
-				max = fabs(m_chipdraw_tables[p_table_nr][index_sub_table][index_position]);
-			}
-		}
-		// increment seed frequency by minor third = 2^(3/12)
-		seed_freq *= 1.1892071150;
-
-		// set pointers
-		m_chipdraw_pointers[p_table_nr][index_sub_table] = m_chipdraw_tables[p_table_nr][index_sub_table];
-	}
-
-	// do another round to scale the table
-	// avoid division by 0
-	if (max > 1e-5) {
-		max = 1.f / max; // for faster computation
-	}
-	for (int index_sub_table = 0; index_sub_table < SUBTABLES_PER_WAVETABLE; ++index_sub_table) {
-		for (int index_position = 0; index_position < WAVETABLE_LENGTH; ++index_position) {
-			m_chipdraw_tables[p_table_nr][index_sub_table][index_position] *= max;
-		}
-	}
+	createDrawnCoefficients(p_chipdraw_values, CHIPDRAW_STEPS_X, true, chipdraw_coefficients);
+	createDrawnSubtables(
+	    chipdraw_coefficients, NUMBER_OF_HARMONICS, p_samplerate, NUMBER_OF_WAVEDRAW_TABLES + p_table_nr);
 }
 
 void WavetableContainer::createWavedrawTable(int p_table_nr,
                                              float p_wavedraw_values[WAVEDRAW_STEPS_X],
                                              float p_samplerate,
                                              bool p_const_sections) {
-
-	// first generate the fourier coefficients
 	float wavedraw_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS];
+	createDrawnCoefficients(p_wavedraw_values, WAVEDRAW_STEPS_X, p_const_sections, wavedraw_coefficients);
+	createDrawnSubtables(wavedraw_coefficients, NUMBER_OF_HARMONICS, p_samplerate, p_table_nr);
+}
 
-	float step_width = 2 * PI / WAVEDRAW_STEPS_X;
-
-	for (int harmonic = 1; harmonic < NUMBER_OF_HARMONICS; ++harmonic) {
-
-		float coeff_sine   = 0.f;
-		float coeff_cosine = 0.f;
-
-		for (int segment = 0; segment < WAVEDRAW_STEPS_X; ++segment) {
-			// use either const sections or linear sections
-			if (p_const_sections) {
-				coeff_sine += const_segment_one_overtone_sine(
-				    segment * step_width, (segment + 1) * step_width, p_wavedraw_values[segment], harmonic);
-				coeff_cosine += const_segment_one_overtone_cosine(
-				    segment * step_width, (segment + 1) * step_width, p_wavedraw_values[segment], harmonic);
-			} else {
-				// wrap function value at end to start
-				float segment_end_value =
-				    (segment == WAVEDRAW_STEPS_X - 1) ? p_wavedraw_values[0] : p_wavedraw_values[segment + 1];
-
-				coeff_sine += lin_segment_one_overtone_sine(segment * step_width,
-				                                            (segment + 1) * step_width,
-				                                            p_wavedraw_values[segment],
-				                                            segment_end_value,
-				                                            harmonic);
-				coeff_cosine += lin_segment_one_overtone_cosine(segment * step_width,
-				                                                (segment + 1) * step_width,
-				                                                p_wavedraw_values[segment],
-				                                                segment_end_value,
-				                                                harmonic);
-			}
-		}
-		wavedraw_coefficients[0][harmonic] = coeff_sine;
-		wavedraw_coefficients[1][harmonic] = coeff_cosine;
+void WavetableContainer::createSpecdrawTable(int p_table_nr,
+                                             float p_specdraw_values[SPECDRAW_STEPS_X],
+                                             float p_samplerate) {
+	// the drawn values are the sine harmonics already
+	float specdraw_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS] = {{0}};
+	for (int harmonic = 1; harmonic < SPECDRAW_STEPS_X + 1; ++harmonic) {
+		specdraw_coefficients[0][harmonic] = p_specdraw_values[harmonic - 1] * m_specdraw_scalar[harmonic - 1];
 	}
+	createDrawnSubtables(specdraw_coefficients,
+	                     SPECDRAW_STEPS_X + 1,
+	                     p_samplerate,
+	                     NUMBER_OF_WAVEDRAW_TABLES + NUMBER_OF_CHIPDRAW_TABLES + p_table_nr);
+}
 
-	// now create the wavetable from the fourier coefficients
-	double seed_freq = 27.5; // A0
-	float max        = 0.f;
-
-	// delete old table
-	memset(m_wavedraw_tables[p_table_nr], 0, SUBTABLES_PER_WAVETABLE * WAVETABLE_LENGTH * sizeof(float));
-
-	// loop over subtables
-	for (int index_sub_table = 0; index_sub_table < SUBTABLES_PER_WAVETABLE; ++index_sub_table) {
-
-		// how many harmonics are needed for this subtable
-		int number_of_harmonics = (int)((p_samplerate * 0.5f / seed_freq) - 1);
-
-		// don't allow more than 256 harmonics (for big Samplerates this might
-		// happen)
-		number_of_harmonics = number_of_harmonics > NUMBER_OF_HARMONICS ? NUMBER_OF_HARMONICS : number_of_harmonics;
-
-		for (int index_position = 0; index_position < WAVETABLE_LENGTH; ++index_position) {
-			for (int index_harmonics = 1; index_harmonics < number_of_harmonics; ++index_harmonics) {
+void WavetableContainer::createDrawnCoefficients(const float *p_values,
+                                                 int p_steps,
+                                                 bool p_const_sections,
+                                                 float po_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS]) {
+	jassert(p_steps <= DRAWN_STEPS_MAX);
+	const double step_width = 2. * PI / p_steps;
+
+	double step_cos[DRAWN_STEPS_MAX];
+	double step_sin[DRAWN_STEPS_MAX];
+	for (int step = 0; step < p_steps; ++step) {
+		step_cos[step] = cos(step * step_width);
+		step_sin[step] = sin(step * step_width);
+	}
 
-				// fill table with
-				// sine harmonics
-				m_wavedraw_tables[p_table_nr][index_sub_table][index_position] +=
-				    wavedraw_coefficients[0][index_harmonics] *
-				    sin(2.f * PI * index_position * index_harmonics / (float)WAVETABLE_LENGTH);
-				// cosine
-				m_wavedraw_tables[p_table_nr][index_sub_table][index_position] +=
-				    wavedraw_coefficients[1][index_harmonics] *
-				    cos(2.f * PI * index_position * index_harmonics / (float)WAVETABLE_LENGTH);
-			}
-			// find max among all tables
-			if (fabs(m_wavedraw_tables[p_table_nr][index_sub_table][index_position]) > max) {
-				max = fabs(m_wavedraw_tables[p_table_nr][index_sub_table][index_position]);
-			}
+	// the drawn function is the values convolved with one const or lin section. So its spectrum is the dft of the
+	// values, which repeats every p_steps harmonics, times the spectrum of a single section. The step count is not a
+	// power of two (193 for wavedraw), but a direct dft over it is cheap enough
+	double dft_real[DRAWN_STEPS_MAX];
+	double dft_imag[DRAWN_STEPS_MAX];
+	for (int bin = 0; bin < p_steps; ++bin) {
+		double real = 0.;
+		double imag = 0.;
+		for (int step = 0; step < p_steps; ++step) {
+			const int phase = (bin * step) % p_steps;
+			real += p_values[step] * step_cos[phase];
+			imag -= p_values[step] * step_sin[phase];
 		}
-		// increment seed frequency by minor third = 2^(3/12)
-		seed_freq *= 1.1892071150;
-
-		// set pointers
-		m_wavedraw_pointers[p_table_nr][index_sub_table] = m_wavedraw_tables[p_table_nr][index_sub_table];
-		// DBG((long)m_wavedraw_pointers[p_table_nr][index_sub_table]);
+		dft_real[bin] = real;
+		dft_imag[bin] = imag;
 	}
 
-	// do another round to scale the table
-	// avoid division by 0
-	if (max > 1e-5) {
-		max = 1.f / max; // for faster computation
-	}
-	for (int index_sub_table = 0; index_sub_table < SUBTABLES_PER_WAVETABLE; ++index_sub_table) {
-		for (int index_position = 0; index_position < WAVETABLE_LENGTH; ++index_position) {
-			m_wavedraw_tables[p_table_nr][index_sub_table][index_position] *= max;
+	po_coefficients[0][0] = 0.f;
+	po_coefficients[1][0] = 0.f;
+	for (int harmonic = 1; harmonic < NUMBER_OF_HARMONICS; ++harmonic) {
+		const double half_step = 0.5 * harmonic * step_width;
+		const double sinc      = sin(half_step) / half_step;
+
+		double real = dft_real[harmonic % p_steps] * step_width;
+		double imag = dft_imag[harmonic % p_steps] * step_width;
+		if (p_const_sections) {
+			// a const section is a box starting at its value, i.e. delayed by half a step
+			const double shift_real = cos(half_step) * sinc;
+			const double shift_imag = -sin(half_step) * sinc;
+			const double shifted    = real * shift_real - imag * shift_imag;
+			imag                    = real * shift_imag + imag * shift_real;
+			real                    = shifted;
+		} else {
+			// a lin section is a triangle centered on its value
+			real *= sinc * sinc;
+			imag *= sinc * sinc;
 		}
+		po_coefficients[0][harmonic] = (float)-imag;
+		po_coefficients[1][harmonic] = (float)real;
 	}
 }
 
-void WavetableContainer::createSpecdrawTable(int p_table_nr,
-                                             float p_specdraw_values[SPECDRAW_STEPS_X],
-                                             float p_samplerate) {
-	// now create the wavetable from the fourier coefficients
-	double seed_freq = 27.5; // A0
-	float max        = 0.f;
+void WavetableContainer::createDrawnSubtables(float p_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS],
+                                              int p_harmonics_max,
+                                              float p_samplerate,
+                                              int p_draw_table) {
+	// the audio thread holds the staging copy only while it copies it, a table it did not pick up yet is replaced
+	std::atomic<int> &state = m_draw_staging_state[p_draw_table];
+	int expected            = state.load();
+	while (expected == StagingCopying || !state.compare_exchange_weak(expected, StagingWriting)) {
+		Thread::yield();
+		expected = state.load();
+	}
+	float(*po_tables)[WAVETABLE_LENGTH] = m_draw_staging[p_draw_table];
+
+	double seed_freq       = 27.5; // A0
+	float max              = 0.f;
+	int previous_harmonics = -1;
 
-	// delete old table
-	memset(m_specdraw_tables[p_table_nr], 0, SUBTABLES_PER_WAVETABLE * WAVETABLE_LENGTH * sizeof(float));
+	// interleaved complex bins for the inverse fft, which scales by 1 / WAVETABLE_LENGTH
+	float spectrum[2 * WAVETABLE_LENGTH];
+	const float bin_scale = WAVETABLE_LENGTH * 0.5f;
 
-	// loop over subtables
 	for (int index_sub_table = 0; index_sub_table < SUBTABLES_PER_WAVETABLE; ++index_sub_table) {
 
 		// how many harmonics are needed for this subtable
 		int number_of_harmonics = (int)((p_samplerate * 0.5f / seed_freq) - 1);
+		number_of_harmonics     = number_of_harmonics > p_harmonics_max ? p_harmonics_max : number_of_harmonics;
+
+		float *table = po_tables[index_sub_table];
+		if (number_of_harmonics == previous_harmonics) {
+			// the lowest subtables all hit the harmonic limit
+			memcpy(table, po_tables[index_sub_table - 1], WAVETABLE_LENGTH * sizeof(float));
+		} else {
+			memset(spectrum, 0, sizeof(spectrum));
+			for (int harmonic = 1; harmonic < number_of_harmonics; ++harmonic) {
+				spectrum[2 * harmonic]     = p_coefficients[1][harmonic] * bin_scale;
+				spectrum[2 * harmonic + 1] = -p_coefficients[0][harmonic] * bin_scale;
+			}
+			m_fft.performRealOnlyInverseTransform(spectrum);
+			memcpy(table, spectrum, WAVETABLE_LENGTH * sizeof(float));
+		}
+		previous_harmonics = number_of_harmonics;
 
-		number_of_harmonics = number_of_harmonics > SPECDRAW_STEPS_X + 1 ? SPECDRAW_STEPS_X + 1 : number_of_harmonics;
-
+		// find max among all tables
 		for (int index_position = 0; index_position < WAVETABLE_LENGTH; ++index_position) {
-			for (int index_harmonics = 1; index_harmonics < number_of_harmonics; ++index_harmonics) {
-
-				// fill table with
-				// sine harmonics
-				m_specdraw_tables[p_table_nr][index_sub_table][index_position] +=
-				    p_specdraw_values[index_harmonics - 1] * m_specdraw_scalar[index_harmonics - 1] *
-				    sin(2.f * PI * index_position * index_harmonics / (float)WAVETABLE_LENGTH);
-			}
-			// find max among all tables
-			if (fabs(m_specdraw_tables[p_table_nr][index_sub_table][index_position]) > max) {
-				max = fabs(m_specdraw_tables[p_table_nr][index_sub_table][index_position]);
+			if (fabs(table[index_position]) > max) {
+				max = fabs(table[index_position]);
 			}
 		}
 		// increment seed frequency by minor third = 2^(3/12)
 		seed_freq *= 1.1892071150;
-
-		// set pointers
-		m_specdraw_pointers[p_table_nr][index_sub_table] = m_specdraw_tables[p_table_nr][index_sub_table];
 	}
 
 	// do another round to scale the table
@@ -404,52 +332,22 @@ void WavetableContainer::createSpecdrawTable(int p_table_nr,
 	}
 	for (int index_sub_table = 0; index_sub_table < SUBTABLES_PER_WAVETABLE; ++index_sub_table) {
 		for (int index_position = 0; index_position < WAVETABLE_LENGTH; ++index_position) {
-			m_specdraw_tables[p_table_nr][index_sub_table][index_position] *= max;
+			po_tables[index_sub_table][index_position] *= max;
 		}
 	}
-}
-
-float WavetableContainer::lin_segment_one_overtone_sine(float p_a, float p_b, float p_fa, float p_fb, int p_ot) {
-
-	float m = (p_fb - p_fa) / (p_b - p_a); // slope of linear function
-	float c = p_fa - m * p_a;              // const offset of linear function
-
-	if (p_ot == 0) {
-		return m / 2.f * p_b * p_b + c * p_b - m / 2.f * p_a * p_a - c * p_a;
-	}
-
-	return (m * (sin(p_b * p_ot) - sin(p_a * p_ot)) + p_ot * (p_a * m + c) * cos(p_a * p_ot) -
-	        p_ot * (p_b * m + c) * cos(p_b * p_ot)) /
-	       p_ot / p_ot;
-}
-
-float WavetableContainer::lin_segment_one_overtone_cosine(float p_a, float p_b, float p_fa, float p_fb, int p_ot) {
-
-	if (p_ot == 0) {
-		// is actually not zero, but idgaf since const offsets are not used
-		return 0;
-	}
-
-	float m = (p_fb - p_fa) / (p_b - p_a); // slope of linear function
-	float c = p_fa - m * p_a;              // const offset of linear function
 
-	return (-p_ot * (p_a * m + c) * sin(p_a * p_ot) - m * cos(p_a * p_ot) + p_ot * (p_b * m + c) * sin(p_b * p_ot) +
-	        m * cos(p_b * p_ot)) /
-	       p_ot / p_ot;
-}
-
-float WavetableContainer::const_segment_one_overtone_sine(float p_start, float p_end, float p_height, int p_harmonic) {
-	if (p_harmonic == 0) {
-		return 0;
-	}
-	return p_height / (float)p_harmonic * (cos(p_start * (float)p_harmonic) - cos(p_end * (float)p_harmonic));
+	state.store(StagingReady);
 }
 
-float WavetableContainer::const_segment_one_overtone_cosine(float p_start, float p_end, float p_height, int p_harmonic) {
-	if (p_harmonic == 0) {
-		return (p_end - p_start) * p_height;
+void WavetableContainer::applyStagedDrawTables() {
+	for (int table = 0; table < DRAW_TABLES; ++table) {
+		int expected = StagingReady;
+		if (m_draw_staging_state[table].load() == StagingReady &&
+		    m_draw_staging_state[table].compare_exchange_strong(expected, StagingCopying)) {
+			memcpy(m_draw_live[table], m_draw_staging[table], sizeof(m_draw_staging[table]));
+			m_draw_staging_state[table].store(StagingIdle);
+		}
 	}
-	return p_height / (float)p_harmonic * (sin(p_end * (float)p_harmonic) - sin(p_start * (float)p_harmonic));
 }
 
 float **WavetableContainer::getChipdrawPointer(int p_chipdraw_index) {
@@ -467,80 +365,17 @@ float **WavetableContainer::getSpecdrawPointer(int p_specdraw_index) {
 }
 
 const float **WavetableContainer::getWavetablePointers(int p_wavetable) {
-	return m_const_wavetable_pointers[p_wavetable];
+	return m_factory_tables->getWavetablePointers(p_wavetable);
 }
 
 const float **WavetableContainer::getWavetablePointers(const std::string &p_name) {
-	// for(int wt = 0; wt < NUMBER_OF_WAVETABLES; ++wt){
-	//     if(p_name == m_wavetable_names_1D[wt]){
-	//         return m_wavetable_pointers[wt];
-	//     }
-	// }
-
-	auto it = m_name_index_map.find(p_name);
-	if (it != m_name_index_map.end()) {
-		return m_const_wavetable_pointers[it->second];
-	}
-
-	
-	return m_const_wavetable_pointers[0]; // return sine if no wt found
+	return m_factory_tables->getWavetablePointers(p_name);
 }
 
 const float **WavetableContainer::getLFOPointers(const std::string &p_name) {
-	auto it = m_LFO_name_index_map.find(p_name);
-	if (it != m_LFO_name_index_map.end()) {
-		return m_const_LFO_pointers[it->second];
-	}
-	DBG("Couldn't find LFO table " + p_name);
-	return m_const_LFO_pointers[0];
-}
-
-void WavetableContainer::loadWavetablesFromConstData() {
-
-	for (int index_wavetable = 0; index_wavetable < NUMBER_OF_WAVETABLES; ++index_wavetable) {
-
-		for (int index_subtable = 0; index_subtable < SUBTABLES_PER_WAVETABLE; ++index_subtable) {
-			m_const_wavetable_pointers[index_wavetable][index_subtable] =
-			    getOneSubTable(index_wavetable, index_subtable);
-		}
-		m_name_index_map.insert(std::pair<std::string, int>(m_wavetable_names_1D[index_wavetable], index_wavetable));
-		//String DEBUG_LIST_FUCK = "";
-
-	//for (auto it = m_name_index_map.begin(); it != m_name_index_map.end(); it++) {
-	//	DEBUG_LIST_FUCK = DEBUG_LIST_FUCK + it->first + ", ";
-	//}
-
-	//DBG("COULDN'T FIND WAVETABLE WITH NAME " + p_name);
-	//AlertWindow::showMessageBox(
-	  //  AlertWindow::AlertIconType::WarningIcon,  " MAPSIZE AT: "+String(m_wavetable_names_1D[index_wavetable]) +"..." + String(m_name_index_map.size()), DEBUG_LIST_FUCK, m_wavetable_names_1D[index_wavetable]);
-	}
-
-	for (int index_wavetable = 0; index_wavetable < NUMBER_OF_WAVETABLES; ++index_wavetable) {
-
-		int index_subtable                                    = 0;
-		m_const_LFO_pointers[index_wavetable][index_subtable] = getOneLFOTable(index_wavetable);
-		m_LFO_name_index_map.insert(std::pair<std::string, int>(m_LFO_names[index_wavetable], index_wavetable));
-	}
-}
-
-void WavetableContainer::loadWavetablesAfterFourierCreation() {
-
-	for (int index_wavetable = 0; index_wavetable < NUMBER_OF_WAVETABLES; ++index_wavetable) {
-
-		for (int index_subtable = 0; index_subtable < SUBTABLES_PER_WAVETABLE; ++index_subtable) {
-			// m_const_wavetable_pointers[index_wavetable][index_subtable] =
-			// getOneSubTable(index_wavetable, index_subtable);
-			m_const_wavetable_pointers[index_wavetable][index_subtable] = m_wavetables[index_wavetable][index_subtable];
-		}
-		m_name_index_map.insert(std::pair<std::string, int>(m_wavetable_names_1D[index_wavetable], index_wavetable));
-	}
+	return m_factory_tables->getLFOPointers(p_name);
 }
 
 int WavetableContainer::getWavetableIndexFromName(const std::string &p_name) {
-	auto it = m_name_index_map.find(p_name);
-	if (it != m_name_index_map.end()) {
-		return it->second;
-	}
-	DBG("getWavetableIndexFromName(): COULDNT FIND WT WITH NAME " + p_name);
-	return 0;
+	return m_factory_tables->getWavetableIndexFromName(p_name);
 }
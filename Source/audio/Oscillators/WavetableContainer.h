@@ -18,30 +18,20 @@
 
 #include "../../GlobalIncludes.h"
 #include "../OdinConstants.h"
-#include "Wavetables/Tables/LFOTableData.h"
-#include "Wavetables/Tables/WavetableData.h"
-#include <map>
+#include "FactoryWavetables.h"
+#include "../JuceLibraryCode/JuceHeader.h"
+#include <atomic>
 #include <string>
 
+#define DRAW_TABLES (NUMBER_OF_WAVEDRAW_TABLES + NUMBER_OF_CHIPDRAW_TABLES + NUMBER_OF_SPECDRAW_TABLES)
+
+// every plugin instance has its own container for the draw tables, which the user edits. The factory tables are
+// read-only and shared by all instances in the process, see FactoryWavetables
 class WavetableContainer {
 public:
-
-
-  //this class isn't used as a singleton anymore, since it messes with havning mutliple plugin instances
-  //static WavetableContainer &getInstance() {
-  //  static WavetableContainer instance;
-  //  return instance;
-  //}
-  //WavetableContainer(WavetableContainer const &) = delete;
-  //void operator=(WavetableContainer const &) = delete;
-
   WavetableContainer();
   virtual ~WavetableContainer();
 
-  void loadWavetablesFromConstData(); // assign pointers to wavetables from
-                                      // files directly
-  void loadWavetablesAfterFourierCreation(); // assign pointers to wavetables
-                                             // from files directly
   void createWavetables(float p_samplerate); // create and allocate memory from
                                              // coefficients and assign pointers
   void createLFOtables(float p_samplerate);
@@ -64,6 +54,10 @@ public:
 
   int getWavetableIndexFromName(const std::string &p_name);
 
+  // copies the drawn tables which were created since the last call over the
+  // ones the oscillators read, audio thread only
+  void applyStagedDrawTables();
+
 private:
   //WavetableContainer();
 
@@ -75,54 +69,51 @@ protected:
   //                          0}; // index [x][1][0] will store scalar, since it
                                 // is usually constant offset
 
-  //the following functions generato the contribution of a const / lin segment in a function to the fourier transform for a given overtone.
-  //do this for all const / lin segments in a funciton to get the fourier transform for any piecewise const or lin function
-  float const_segment_one_overtone_sine(float p_start, float p_end,
-                                        float p_height, int p_harmonic);
-  float const_segment_one_overtone_cosine(float p_start, float p_end,
-                                          float p_height, int p_harmonic);
-  float lin_segment_one_overtone_sine(float p_a, float p_b, float p_fa,
-                                      float p_fb, int p_ot);
-  float lin_segment_one_overtone_cosine(float p_a, float p_b, float p_fa,
-                                        float p_fb, int p_ot);
+  // fourier coefficients of a drawn function, which is piecewise const or
+  // lin between p_steps evenly spaced values over one period
+  void createDrawnCoefficients(
+      const float *p_values, int p_steps, bool p_const_sections,
+      float po_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS]);
+  // band limits the coefficients for every subtable with an inverse fft,
+  // normalizes the whole table and stages it for p_draw_table
+  void createDrawnSubtables(
+      float p_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS],
+      int p_harmonics_max, float p_samplerate, int p_draw_table);
 
-  std::map<std::string, int> m_name_index_map;
-  std::map<std::string, int> m_LFO_name_index_map;
+  dsp::FFT m_fft{WAVETABLE_FFT_ORDER};
 
   //float m_LFO_fourier_coeffs[NUMBER_OF_LFOTABLES][SIN_AND_COS]
   //                          [NUMBER_OF_HARMONICS] = {
   //                              0}; // index [x][1][0] will store scalar, since
                                     // it is usually constant offset
 
-  const float *m_const_wavetable_pointers[NUMBER_OF_WAVETABLES]
-                                         [SUBTABLES_PER_WAVETABLE];
-  const float *m_const_LFO_pointers[NUMBER_OF_WAVETABLES][1];
+  SharedResourcePointer<FactoryWavetables> m_factory_tables;
 
   // Wavetable pointers
-  float *m_wavetable_pointers[NUMBER_OF_WAVETABLES][SUBTABLES_PER_WAVETABLE];
   float
       *m_chipdraw_pointers[NUMBER_OF_CHIPDRAW_TABLES][SUBTABLES_PER_WAVETABLE];
   float
       *m_wavedraw_pointers[NUMBER_OF_WAVEDRAW_TABLES][SUBTABLES_PER_WAVETABLE];
   float
       *m_specdraw_pointers[NUMBER_OF_SPECDRAW_TABLES][SUBTABLES_PER_WAVETABLE];
-  float *m_lfotable_pointers[NUMBER_OF_LFOTABLES][1];
 
   // drawn tables
   float m_chipdraw_tables[NUMBER_OF_CHIPDRAW_TABLES][SUBTABLES_PER_WAVETABLE]
-                         [WAVETABLE_LENGTH];
+                         [WAVETABLE_LENGTH] = {0};
   float m_wavedraw_tables[NUMBER_OF_WAVEDRAW_TABLES][SUBTABLES_PER_WAVETABLE]
                          [WAVETABLE_LENGTH] = {0};
   float m_specdraw_tables[NUMBER_OF_SPECDRAW_TABLES][SUBTABLES_PER_WAVETABLE]
-                         [WAVETABLE_LENGTH];
+                         [WAVETABLE_LENGTH] = {0};
+
+  // the oscillators read the drawn tables above while the gui or a patch
+  // load creates new ones. A new table is written to its staging copy, the
+  // audio thread copies it over the live one in applyStagedDrawTables(). The
+  // draw tables are numbered wavedraw, chipdraw, specdraw
+  enum StagingState { StagingIdle, StagingWriting, StagingReady, StagingCopying };
+  float m_draw_staging[DRAW_TABLES][SUBTABLES_PER_WAVETABLE][WAVETABLE_LENGTH];
+  std::atomic<int> m_draw_staging_state[DRAW_TABLES];
+  float (*m_draw_live[DRAW_TABLES])[WAVETABLE_LENGTH];
 
   // specdraw scalar (1/sqrt(harmonic))
   float m_specdraw_scalar[SPECDRAW_STEPS_X];
-
-  std::string m_wavetable_names_1D[NUMBER_OF_WAVETABLES];
-  std::string m_LFO_names[NUMBER_OF_WAVETABLES];
-
-  bool m_wavetables_created = false;
-
-  float ***m_wavetables; // dynamic allocation
 };
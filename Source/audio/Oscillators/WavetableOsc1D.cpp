@@ -83,8 +83,19 @@ float WavetableOsc1D::doWavetable() {
 	float fractional     = m_read_index - (float)read_index_trunc;
 	int read_index_next  = read_index_trunc + 1 >= WAVETABLE_LENGTH ? 0 : read_index_trunc + 1;
 
-	// do linear interpolation
-	float output = linearInterpolation(m_current_table[read_index_trunc], m_current_table[read_index_next], fractional);
+	float output;
+	if (m_cubic_interpolation) {
+		int read_index_prev  = read_index_trunc == 0 ? WAVETABLE_LENGTH - 1 : read_index_trunc - 1;
+		int read_index_after = read_index_next + 1 >= WAVETABLE_LENGTH ? 0 : read_index_next + 1;
+		output               = cubicInterpolation(m_current_table[read_index_prev],
+		                                          m_current_table[read_index_trunc],
+		                                          m_current_table[read_index_next],
+		                                          m_current_table[read_index_after],
+		                                          fractional);
+	} else {
+		// do linear interpolation
+		output = linearInterpolation(m_current_table[read_index_trunc], m_current_table[read_index_next], fractional);
+	}
 
 	m_read_index += m_wavetable_inc * m_sync_anti_aliasing_inc_factor;
 	checkWrapIndex(m_read_index);
@@ -100,17 +111,13 @@ float WavetableOsc1D::doOscillate() {
 
 void WavetableOsc1D::setWavetablePointer(int p_wavetable_index,
                                          const float *p_wavetable_pointers[SUBTABLES_PER_WAVETABLE]) {
-	for (int sub_table = 0; sub_table < SUBTABLES_PER_WAVETABLE; sub_table++) {
-		m_wavetable_pointers[p_wavetable_index][sub_table] = p_wavetable_pointers[sub_table];
-	}
+	m_wavetable_pointers[p_wavetable_index] = p_wavetable_pointers;
 }
 
 // nonconst is needed for draw tables
 void WavetableOsc1D::setWavetablePointerNONCONST(int p_wavetable_index,
                                                  float *p_wavetable_pointers[SUBTABLES_PER_WAVETABLE]) {
-	for (int sub_table = 0; sub_table < SUBTABLES_PER_WAVETABLE; sub_table++) {
-		m_wavetable_pointers[p_wavetable_index][sub_table] = p_wavetable_pointers[sub_table];
-	}
+	m_wavetable_pointers[p_wavetable_index] = p_wavetable_pointers;
 }
 
 void WavetableOsc1D::selectWavetable(int p_wavetable_index) {
@@ -164,6 +171,10 @@ float WavetableOsc1D::doOscillateWithSync() {
 		if (m_sync_oscillator->m_reset_flag) {
 			initiateSync();
 		}
+		if (!m_internal_oversampling) {
+			m_sync_anti_aliasing_inc_factor = 1.f;
+			return m_dc_blocking_filter.doFilter(doOscillate());
+		}
 		m_sync_anti_aliasing_inc_factor = 0.3333333f;
 
 		float input_upsampled[3] = {doOscillate(), doOscillate(), doOscillate()};
@@ -30,7 +30,7 @@ public:
 	std::function<void(int)> selectWavetableByMapping = [](int) { jassert(false); };
 
 	virtual void randomizePhase() override {
-		m_read_index = (float)rand() / (float)RAND_MAX * WAVETABLE_LENGTH;
+		m_read_index = m_random.nextFloat() * WAVETABLE_LENGTH;
 	}
 
 	WavetableOsc1D();
@@ -67,6 +67,16 @@ public:
 		m_sync_enabled = p_sync;
 	}
 
+	// hard sync is oversampled 3x unless the whole voice already runs oversampled
+	void setInternalOversampling(bool p_enabled) {
+		m_internal_oversampling = p_enabled;
+	}
+
+	// cubic instead of linear interpolation between the table samples, for offline renders
+	void setCubicInterpolation(bool p_cubic) {
+		m_cubic_interpolation = p_cubic;
+	}
+
 	void setSampleRate(float p_sr) override {
 		Oscillator::setSampleRate(p_sr);
 		m_dc_blocking_filter.setSampleRate(p_sr);
@@ -90,6 +100,14 @@ protected:
 		return p_distance * (p_high - p_low) + p_low;
 	}
 
+	// 4 point 3rd order hermite, interpolates between p_y1 and p_y2
+	inline float cubicInterpolation(float p_y0, float p_y1, float p_y2, float p_y3, float p_distance) {
+		const float c1 = 0.5f * (p_y2 - p_y0);
+		const float c2 = p_y0 - 2.5f * p_y1 + 2.f * p_y2 - 0.5f * p_y3;
+		const float c3 = 0.5f * (p_y3 - p_y0) + 1.5f * (p_y1 - p_y2);
+		return ((c3 * p_distance + c2) * p_distance + c1) * p_distance + p_y1;
+	}
+
 	inline void checkWrapIndex(double &p_index) {
 
 		m_reset_flag = false;
@@ -110,7 +128,9 @@ protected:
 	// for sync
 	DCBlockingFilter m_dc_blocking_filter;
 
-	bool m_sync_enabled = false;
+	bool m_sync_enabled          = false;
+	bool m_internal_oversampling = true;
+	bool m_cubic_interpolation   = false;
 
 	float m_volume_factor = 1.f;
 
@@ -124,9 +144,8 @@ protected:
 	double xv[10] = {0.};
 	double yv[10] = {0.};
 
-	// tables
-	const float *m_wavetable_pointers[NUMBER_OF_WAVETABLES + 9] //+ 9 for drawtables
-	                                 [SUBTABLES_PER_WAVETABLE];
+	// tables, these point to the subtable arrays in the WavetableContainer instead of copying them into every oscillator
+	const float *const *m_wavetable_pointers[NUMBER_OF_WAVETABLES + 9] = {nullptr}; //+ 9 for drawtables
 	const float *m_current_table;
 	int m_wavetable_index = 0;
 	int m_sub_table_index = 0;
@@ -964,16 +964,16 @@ void WavetableOsc2D::update() {
 	m_wavetable_inc   = WAVETABLE_LENGTH * m_increment;
 	m_sub_table_index = getTableIndex();
 
-	// set wavetable pointer
-	m_current_table_2D = m_wavetable_pointers_2D[m_wavetable_index][m_sub_table_index];
+	// set wavetable pointers
+	for (int table = 0; table < TABLES_PER_2D_WT; ++table) {
+		m_current_table_2D[table] = m_wavetable_pointers_2D[m_wavetable_index][table][m_sub_table_index];
+	}
 }
 
 void WavetableOsc2D::setWavetablePointer(int p_wavetable_index,
                                          int p_2D_sub_table,
                                          const float *p_wavetable_pointers[SUBTABLES_PER_WAVETABLE]) {
-	for (int sub_table = 0; sub_table < SUBTABLES_PER_WAVETABLE; sub_table++) {
-		m_wavetable_pointers_2D[p_wavetable_index][sub_table][p_2D_sub_table] = p_wavetable_pointers[sub_table];
-	}
+	m_wavetable_pointers_2D[p_wavetable_index][p_2D_sub_table] = p_wavetable_pointers;
 }
 
 float WavetableOsc2D::doWavetable2D() {
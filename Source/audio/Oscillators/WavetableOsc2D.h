@@ -127,8 +127,8 @@ protected:
 
 
 
-  const float
-      *m_wavetable_pointers_2D[NUMBER_OF_WAVETABLES_2D][SUBTABLES_PER_WAVETABLE]
-                              [TABLES_PER_2D_WT];
-  const float **m_current_table_2D;
+  // the subtable arrays of the four tables of each 2D wavetable, these live in the WavetableContainer
+  const float *const
+      *m_wavetable_pointers_2D[NUMBER_OF_WAVETABLES_2D][TABLES_PER_2D_WT] = {{nullptr}};
+  const float *m_current_table_2D[TABLES_PER_2D_WT] = {nullptr};
 };
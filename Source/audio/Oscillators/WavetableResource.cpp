@@ -0,0 +1,238 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "WavetableResource.h"
+
+#include <cmath>
+#include <cstring>
+
+static const char s_magic[4] = {'O', 'd', 'W', 'T'};
+
+// size of the blob after the header
+static size_t getPayloadSize(WavetableResource::Format p_format) {
+	switch (p_format) {
+	case WavetableResource::Int16:
+		return WAVETABLE_RESOURCE_NUM_SUBTABLES * sizeof(float) + WAVETABLE_RESOURCE_NUM_SAMPLES * sizeof(int16);
+	case WavetableResource::Half:
+		return WAVETABLE_RESOURCE_NUM_SAMPLES * sizeof(uint16);
+	default:
+		return WAVETABLE_RESOURCE_NUM_SAMPLES * sizeof(float);
+	}
+}
+
+static float readFloat(const uint8 *p_data) {
+	const uint32 bits = ByteOrder::littleEndianInt(p_data);
+	float value;
+	memcpy(&value, &bits, sizeof(float));
+	return value;
+}
+
+bool WavetableResource::write(OutputStream &p_stream, const float *const *p_subtables, Format p_format) {
+	p_stream.write(s_magic, sizeof(s_magic));
+	p_stream.writeInt(WAVETABLE_RESOURCE_VERSION);
+	p_stream.writeInt((int)p_format);
+	p_stream.writeInt(NUMBER_OF_WAVETABLES);
+	p_stream.writeInt(SUBTABLES_PER_WAVETABLE);
+	p_stream.writeInt(WAVETABLE_LENGTH);
+	p_stream.writeInt(0);
+	p_stream.writeInt(0);
+
+	switch (p_format) {
+	case Int16: {
+		float scales[WAVETABLE_RESOURCE_NUM_SUBTABLES];
+		for (int subtable = 0; subtable < WAVETABLE_RESOURCE_NUM_SUBTABLES; ++subtable) {
+			float max = 0.f;
+			for (int sample = 0; sample < WAVETABLE_LENGTH; ++sample) {
+				max = jmax(max, fabsf(p_subtables[subtable][sample]));
+			}
+			scales[subtable] = max > 0.f ? max : 1.f;
+			p_stream.writeFloat(scales[subtable]);
+		}
+		for (int subtable = 0; subtable < WAVETABLE_RESOURCE_NUM_SUBTABLES; ++subtable) {
+			const float factor = 32767.f / scales[subtable];
+			for (int sample = 0; sample < WAVETABLE_LENGTH; ++sample) {
+				p_stream.writeShort((short)roundf(p_subtables[subtable][sample] * factor));
+			}
+		}
+		break;
+	}
+	case Half:
+		for (int subtable = 0; subtable < WAVETABLE_RESOURCE_NUM_SUBTABLES; ++subtable) {
+			for (int sample = 0; sample < WAVETABLE_LENGTH; ++sample) {
+				p_stream.writeShort((short)floatToHalf(p_subtables[subtable][sample]));
+			}
+		}
+		break;
+	default:
+		for (int subtable = 0; subtable < WAVETABLE_RESOURCE_NUM_SUBTABLES; ++subtable) {
+			for (int sample = 0; sample < WAVETABLE_LENGTH; ++sample) {
+				p_stream.writeFloat(p_subtables[subtable][sample]);
+			}
+		}
+		break;
+	}
+
+	p_stream.flush();
+	return p_stream.getStatus().wasOk();
+}
+
+bool WavetableResource::readHeader(const void *p_data, size_t p_size, Format &po_format) {
+	const uint8 *data = static_cast<const uint8 *>(p_data);
+	if (p_data == nullptr || p_size < WAVETABLE_RESOURCE_HEADER_SIZE || memcmp(data, s_magic, sizeof(s_magic)) != 0) {
+		DBG("WavetableResource: not a wavetable resource");
+		return false;
+	}
+	const uint32 version = ByteOrder::littleEndianInt(data + 4);
+	const uint32 format  = ByteOrder::littleEndianInt(data + 8);
+	if (version != WAVETABLE_RESOURCE_VERSION || format > Half) {
+		DBG("WavetableResource: unknown version " + String(version) + " or format " + String(format));
+		return false;
+	}
+	// the tables have to be made again when the table layout changes
+	if (ByteOrder::littleEndianInt(data + 12) != NUMBER_OF_WAVETABLES ||
+	    ByteOrder::littleEndianInt(data + 16) != SUBTABLES_PER_WAVETABLE ||
+	    ByteOrder::littleEndianInt(data + 20) != WAVETABLE_LENGTH) {
+		DBG("WavetableResource: the resource was made for a different table layout");
+		return false;
+	}
+	po_format = (Format)format;
+	if (p_size != WAVETABLE_RESOURCE_HEADER_SIZE + getPayloadSize(po_format)) {
+		DBG("WavetableResource: the resource is truncated");
+		return false;
+	}
+	return true;
+}
+
+const float *WavetableResource::getTablesInPlace(const void *p_data, size_t p_size) {
+	Format format;
+	if (!readHeader(p_data, p_size, format) || format != Float32) {
+		return nullptr;
+	}
+#if JUCE_BIG_ENDIAN
+	return nullptr;
+#else
+	const float *samples = reinterpret_cast<const float *>(static_cast<const uint8 *>(p_data) +
+	                                                       WAVETABLE_RESOURCE_HEADER_SIZE);
+	return ((size_t)samples % alignof(float)) == 0 ? samples : nullptr;
+#endif
+}
+
+bool WavetableResource::read(const void *p_data, size_t p_size, float *po_tables) {
+	Format format;
+	if (!readHeader(p_data, p_size, format)) {
+		return false;
+	}
+
+	const uint8 *payload = static_cast<const uint8 *>(p_data) + WAVETABLE_RESOURCE_HEADER_SIZE;
+	switch (format) {
+	case Int16: {
+		const uint8 *samples = payload + WAVETABLE_RESOURCE_NUM_SUBTABLES * sizeof(float);
+		for (int subtable = 0; subtable < WAVETABLE_RESOURCE_NUM_SUBTABLES; ++subtable) {
+			const float factor = readFloat(payload + subtable * sizeof(float)) / 32767.f;
+			for (int sample = 0; sample < WAVETABLE_LENGTH; ++sample, samples += sizeof(int16)) {
+				*po_tables++ = (float)(int16)ByteOrder::littleEndianShort(samples) * factor;
+			}
+		}
+		break;
+	}
+	case Half:
+		for (int sample = 0; sample < WAVETABLE_RESOURCE_NUM_SAMPLES; ++sample) {
+			po_tables[sample] = halfToFloat(ByteOrder::littleEndianShort(payload + sample * sizeof(uint16)));
+		}
+		break;
+	default:
+#if JUCE_BIG_ENDIAN
+		for (int sample = 0; sample < WAVETABLE_RESOURCE_NUM_SAMPLES; ++sample) {
+			po_tables[sample] = readFloat(payload + sample * sizeof(float));
+		}
+#else
+		memcpy(po_tables, payload, WAVETABLE_RESOURCE_NUM_SAMPLES * sizeof(float));
+#endif
+		break;
+	}
+	return true;
+}
+
+const char *WavetableResource::getFormatName(Format p_format) {
+	switch (p_format) {
+	case Int16:
+		return "int16";
+	case Half:
+		return "half";
+	default:
+		return "float";
+	}
+}
+
+uint16 WavetableResource::floatToHalf(float p_value) {
+	uint32 bits;
+	memcpy(&bits, &p_value, sizeof(float));
+	const uint32 sign     = (bits >> 16) & 0x8000;
+	const int exponent    = (int)((bits >> 23) & 0xff) - 127 + 15;
+	const uint32 mantissa = bits & 0x7fffff;
+
+	if (exponent >= 31) {
+		// the tables are within +-1, this only keeps the conversion complete
+		return (uint16)(sign | 0x7c00);
+	}
+	if (exponent <= 0) {
+		// subnormal or zero in half precision
+		if (exponent < -10) {
+			return (uint16)sign;
+		}
+		const uint32 full_mantissa = mantissa | 0x800000;
+		const int shift            = 14 - exponent;
+		uint32 half_mantissa       = full_mantissa >> shift;
+		if ((full_mantissa >> (shift - 1)) & 1) {
+			++half_mantissa;
+		}
+		return (uint16)(sign | half_mantissa);
+	}
+	// round to nearest, a carry out of the mantissa correctly increments the exponent
+	uint32 half = sign | ((uint32)exponent << 10) | (mantissa >> 13);
+	if (mantissa & 0x1000) {
+		++half;
+	}
+	return (uint16)half;
+}
+
+float WavetableResource::halfToFloat(uint16 p_half) {
+	const uint32 sign  = ((uint32)p_half & 0x8000) << 16;
+	const int exponent = (p_half >> 10) & 0x1f;
+	uint32 mantissa    = p_half & 0x3ff;
+
+	uint32 bits;
+	if (exponent == 0) {
+		if (mantissa == 0) {
+			bits = sign;
+		} else {
+			// normalize the subnormal
+			int shift = 0;
+			while (!(mantissa & 0x400)) {
+				mantissa <<= 1;
+				++shift;
+			}
+			bits = sign | ((uint32)(127 - 14 - shift) << 23) | ((mantissa & 0x3ff) << 13);
+		}
+	} else if (exponent == 31) {
+		bits = sign | 0x7f800000 | (mantissa << 13);
+	} else {
+		bits = sign | ((uint32)(exponent - 15 + 127) << 23) | (mantissa << 13);
+	}
+
+	float value;
+	memcpy(&value, &bits, sizeof(float));
+	return value;
+}
@@ -0,0 +1,52 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../../GlobalIncludes.h"
+#include "../OdinConstants.h"
+#include "../JuceLibraryCode/JuceHeader.h"
+
+#define WAVETABLE_RESOURCE_VERSION 1
+#define WAVETABLE_RESOURCE_HEADER_SIZE 32
+#define WAVETABLE_RESOURCE_NUM_SUBTABLES (NUMBER_OF_WAVETABLES * SUBTABLES_PER_WAVETABLE)
+#define WAVETABLE_RESOURCE_NUM_SAMPLES (WAVETABLE_RESOURCE_NUM_SUBTABLES * WAVETABLE_LENGTH)
+
+/**
+ * The finished, bandlimited factory subtables as one binary blob, so they don't have to be compiled from a huge
+ * source file. odin2-wavetables writes it, builds with ODIN2_WAVETABLE_RESOURCE embed and load it.
+ * The blob is little endian: a header of WAVETABLE_RESOURCE_HEADER_SIZE bytes with the magic "OdWT", the version,
+ * the format and the number of wavetables, subtables and samples, then the subtables one after the other. Int16
+ * stores a float scale per subtable in front of the samples, so every subtable uses the full range.
+ */
+class WavetableResource {
+public:
+	enum Format { Float32 = 0, Int16 = 1, Half = 2 };
+
+	// p_subtables are WAVETABLE_RESOURCE_NUM_SUBTABLES pointers, wavetable by wavetable
+	static bool write(OutputStream &p_stream, const float *const *p_subtables, Format p_format);
+
+	// the samples of a float blob if they can be used where they are, nullptr if they have to be decoded
+	static const float *getTablesInPlace(const void *p_data, size_t p_size);
+	// decodes any format into po_tables, which has room for WAVETABLE_RESOURCE_NUM_SAMPLES
+	static bool read(const void *p_data, size_t p_size, float *po_tables);
+
+	static const char *getFormatName(Format p_format);
+
+private:
+	static bool readHeader(const void *p_data, size_t p_size, Format &po_format);
+	static uint16 floatToHalf(float p_value);
+	static float halfToFloat(uint16 p_half);
+};
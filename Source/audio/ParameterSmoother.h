@@ -0,0 +1,88 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+// difference to the target (relative for values above 1) below which a smoother snaps to it
+#define SMOOTHER_SETTLE_THRESHOLD 0.00001f
+
+/**
+ * One pole smoother for control values. Once it got close enough to its target it snaps to it and stays there
+ * without doing any work until the target changes, so isSettled() tells the caller it deals with a constant and
+ * fill() writes a whole block without smoothing.
+ * The target has to be set from the thread which calls next(), controls written by other threads are handed over
+ * with setTarget() right before the smoother is used.
+ */
+class ParameterSmoother {
+public:
+	ParameterSmoother(double p_factor, float p_value, float p_threshold = SMOOTHER_SETTLE_THRESHOLD) :
+	    m_factor(p_factor), m_threshold(p_threshold), m_value(p_value), m_target(p_value) {
+	}
+
+	inline void setTarget(float p_target) {
+		if (p_target != m_target) {
+			m_target  = p_target;
+			m_settled = false;
+		}
+	}
+
+	// jumps to p_value without smoothing
+	inline void reset(float p_value) {
+		m_value   = p_value;
+		m_target  = p_value;
+		m_settled = true;
+	}
+
+	inline float next() {
+		if (!m_settled) {
+			// the value is kept in double precision, in float slow factors get stuck a few hundred steps off the
+			// target before they reach the threshold
+			m_value = m_value * m_factor + (1.0 - m_factor) * m_target;
+			if (std::fabs(m_value - m_target) <= m_threshold * std::fmax(std::fabs(m_target), 1.f)) {
+				m_value   = m_target;
+				m_settled = true;
+			}
+		}
+		return (float)m_value;
+	}
+
+	// writes the next p_num_values values to po_values, a settled smoother just repeats its value
+	inline void fill(float *po_values, int p_num_values) {
+		if (isSettled()) {
+			std::fill(po_values, po_values + p_num_values, (float)m_value);
+			return;
+		}
+		for (int i = 0; i < p_num_values; ++i) {
+			po_values[i] = next();
+		}
+	}
+
+	inline bool isSettled() const {
+		return m_settled;
+	}
+	inline float getValue() const {
+		return (float)m_value;
+	}
+
+private:
+	double m_factor;
+	float m_threshold;
+	double m_value;
+	float m_target;
+	bool m_settled = true;
+};
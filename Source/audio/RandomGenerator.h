@@ -0,0 +1,66 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Random numbers (xorshift32) for the modules of the voices. The voices run on several threads, libc rand() would
+ * share its state between them and takes a lock for it in some C libraries, so every module owns a generator.
+ * Each generator starts from its own seed, seed() makes the numbers reproducible, e.g. for test renders.
+ */
+class RandomGenerator {
+public:
+	RandomGenerator() {
+		seed(nextInstance());
+	}
+
+	// neighbouring seeds give unrelated sequences
+	void seed(uint32_t p_seed) {
+		uint32_t mixed = p_seed * 0x9e3779b9u + 0x7f4a7c15u;
+		mixed          = (mixed ^ (mixed >> 16)) * 0x85ebca6bu;
+		mixed          = (mixed ^ (mixed >> 13)) * 0xc2b2ae35u;
+		mixed ^= mixed >> 16;
+		// xorshift gets stuck at zero
+		m_state = mixed ? mixed : 0x6d2b79f5u;
+	}
+
+	inline uint32_t nextInt() {
+		m_state ^= m_state << 13;
+		m_state ^= m_state >> 17;
+		m_state ^= m_state << 5;
+		return m_state;
+	}
+
+	// 0 ... 1
+	inline float nextFloat() {
+		return (float)(nextInt() >> 8) * (1.f / 16777215.f);
+	}
+
+	// -1 ... 1
+	inline float nextBipolar() {
+		return 2.f * nextFloat() - 1.f;
+	}
+
+private:
+	static uint32_t nextInstance() {
+		static std::atomic<uint32_t> instances{0};
+		return instances.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	uint32_t m_state;
+};
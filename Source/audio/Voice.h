@@ -37,7 +37,11 @@
 #include "Oscillators/WavetableOsc2D.h"
 #include "ADSR.h"
 
+#include <cstdint>
 #include <cstdlib>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 // one voice of the polyphonic voices, i.e. everything up to the amplifier
 struct Voice {
@@ -48,7 +52,6 @@ struct Voice {
 	}
 
 	Voice() {
-		std::srand((unsigned int)std::time(nullptr));
 		generateNewRandomValue();
 
 		for (int osc = 0; osc < 3; ++osc) {
@@ -119,12 +122,62 @@ struct Voice {
 		vector_osc[2].setSyncOscillator(p_osc);
 	}
 
+	// when the voice itself runs oversampled, hard sync and distortion don't oversample again on their own
+	void setInternalOversampling(bool p_enabled) {
+		for (int osc = 0; osc < 3; ++osc) {
+			analog_osc[osc].setInternalOversampling(p_enabled);
+			wavetable_osc[osc].setInternalOversampling(p_enabled);
+			wavedraw_osc[osc].setInternalOversampling(p_enabled);
+			specdraw_osc[osc].setInternalOversampling(p_enabled);
+			chipdraw_osc[osc].setInternalOversampling(p_enabled);
+			chiptune_osc[osc].setInternalOversampling(p_enabled);
+			vector_osc[osc].setInternalOversampling(p_enabled);
+		}
+		distortion[0].setInternalOversampling(p_enabled);
+		distortion[1].setInternalOversampling(p_enabled);
+	}
+
+	// only the oscillators which read their tables through WavetableOsc1D::doWavetable()
+	void setCubicInterpolation(bool p_cubic) {
+		for (int osc = 0; osc < 3; ++osc) {
+			analog_osc[osc].setCubicInterpolation(p_cubic);
+			chiptune_osc[osc].setCubicInterpolation(p_cubic);
+			fm_osc[osc].setCubicInterpolation(p_cubic);
+			pm_osc[osc].setCubicInterpolation(p_cubic);
+			wavedraw_osc[osc].setCubicInterpolation(p_cubic);
+			chipdraw_osc[osc].setCubicInterpolation(p_cubic);
+			specdraw_osc[osc].setCubicInterpolation(p_cubic);
+		}
+	}
+
 	void setMonoPolyLegato(PlayModes p_mode) {
 		m_mono_poly_legato = p_mode;
 	}
 
 	void generateNewRandomValue() {
-		random_modulation = 2.f * ((float)rand() / (float)RAND_MAX) - 1.f;
+		random_modulation = m_random.nextBipolar();
+	}
+
+	// every module gets its own seed derived from p_seed, so a render with the same seeds is reproducible
+	void seedRandom(uint32_t p_seed) {
+		uint32_t seed = p_seed * 64;
+		m_random.seed(seed++);
+		for (int osc = 0; osc < 3; ++osc) {
+			analog_osc[osc].seedRandom(seed++);
+			wavetable_osc[osc].seedRandom(seed++);
+			multi_osc[osc].seedRandom(seed++);
+			vector_osc[osc].seedRandom(seed++);
+			chiptune_osc[osc].seedRandom(seed++);
+			fm_osc[osc].seedRandom(seed++);
+			pm_osc[osc].seedRandom(seed++);
+			noise_osc[osc].seedRandom(seed++);
+			wavedraw_osc[osc].seedRandom(seed++);
+			chipdraw_osc[osc].seedRandom(seed++);
+			specdraw_osc[osc].seedRandom(seed++);
+			lfo[osc].seedRandom(seed++);
+		}
+		ring_mod[0].seedRandom(seed++);
+		ring_mod[1].seedRandom(seed++);
 	}
 
 	float MIDINoteToFreq(int p_MIDI_note) {
@@ -626,6 +679,8 @@ struct Voice {
 	float MIDI_velocity_mod_source   = 0.f;
 	float MIDI_aftertouch_mod_source = 0.f;
 	float random_modulation;
+	// the voices render on several threads, so they don't share the state of libc rand()
+	RandomGenerator m_random;
 
 	// called when the envelope ends to signal voice end to voice manager
 	// std::function<void()> onEnvelopeEnd = []() {};
@@ -635,14 +690,63 @@ struct Voice {
 };
 
 
-class VoiceManager {
+// the notes held down in mono and legato mode, oldest first. Used to retrigger a held down note if the note after
+// it was released. Fixed size, so note on and off never allocate on the audio thread
+class MonoNoteList {
 public:
-	VoiceManager() {
+	// when the list is full the oldest note is dropped
+	void push_back(int p_note, int p_velocity) {
+		if (m_size == MONO_NOTE_LIST_SIZE) {
+			erase(0);
+		}
+		m_note[m_size]     = p_note;
+		m_velocity[m_size] = p_velocity;
+		++m_size;
+	}
+
+	// removes the oldest entry of p_note, returns whether it was the most recent note
+	bool remove(int p_note) {
+		for (int index = 0; index < m_size; ++index) {
+			if (m_note[index] == p_note) {
+				const bool most_recent = p_note == m_note[m_size - 1];
+				erase(index);
+				return most_recent;
+			}
+		}
+		return false;
+	}
+
+	int backNote() const {
+		return m_note[m_size - 1];
+	}
+	int backVelocity() const {
+		return m_velocity[m_size - 1];
+	}
+	bool empty() const {
+		return m_size == 0;
+	}
+	void clear() {
+		m_size = 0;
+	}
 
-		//fill voice history in ascending order
-		for(int voice = 0; voice < VOICES; ++voice) {
-			m_voice_history.push_back(voice);
+private:
+	void erase(int p_index) {
+		for (int index = p_index; index < m_size - 1; ++index) {
+			m_note[index]     = m_note[index + 1];
+			m_velocity[index] = m_velocity[index + 1];
 		}
+		--m_size;
+	}
+
+	int m_note[MONO_NOTE_LIST_SIZE];
+	int m_velocity[MONO_NOTE_LIST_SIZE];
+	int m_size = 0;
+};
+
+class VoiceManager {
+public:
+	VoiceManager() {
+		reset();
 	}
 
 	//voice return priority:
@@ -651,85 +755,141 @@ public:
 	// 2. free voices
 	// 3. oldest voices in release
 	// 4. oldest voices
-	std::vector<int> getVoices(int p_note, int p_unison) {
-
-		std::vector<int> ret;
+	// writes up to p_unison voices to p_voices (room for VOICES entries) and returns how many there are
+	int getVoices(int p_note, int p_unison, int *p_voices) {
+		int num_voices = 0;
 
 		// in Legato and Mono mode every unison voice is the same
 		if (m_mono_poly_legato != PlayModes::Poly) {
 			for (int voice = 0; voice < p_unison; ++voice) {
-				ret.push_back(voice);
+				p_voices[num_voices++] = voice;
 			}
-			return ret;
+			return num_voices;
 		}
 
 		// return note if it is in sustain (processor kills it)
 		if (m_sustain_active) {
-			for (int voice = 0; voice < VOICES; ++voice) {
+			for (uint64_t kill_list = m_kill_list; kill_list; kill_list &= kill_list - 1) {
+				const int voice = lowestBit(kill_list);
 				//check if THIS note is on kill list
-				if (m_kill_list[voice] && m_kill_list_note[voice] == p_note) {
+				if (m_kill_list_note[voice] == p_note) {
 					// note is on sustain... remove it from kill list, reset voice and use that one
-					m_kill_list[voice] = false;
-					DBG("Note " + std::to_string(p_note) + " stole voice " + std::to_string(voice) +
-					    " out of sustain!");
-					ret.push_back(voice);
-					if (ret.size() >= p_unison) {
-						return ret;
+					removeFromKillList(voice);
+					p_voices[num_voices++] = voice;
+					if (num_voices >= p_unison) {
+						return num_voices;
 					}
 				}
 			}
 		}
 
-		// look for free voices
-		for (int i = 0; i < VOICES; ++i) {
-			if (!voice_busy[i]) {
-				voice_busy[i] = true;
-				//so it doesn't get detected as "in release" in the next block:
-				m_actual_voice_pointers[i]->setReleaseInactiveBeforeStart();
-				removeFromKillList(i);
-				updateVoiceHistory(i);
-				ret.push_back(i);
-				if (ret.size() >= p_unison) {
-					return ret;
-				}
+		// look for free voices, lowest first
+		for (uint64_t free_voices = m_free_voices & polyphonyMask(); free_voices; free_voices &= free_voices - 1) {
+			const int voice = lowestBit(free_voices);
+			m_free_voices &= ~(uint64_t(1) << voice);
+			voice_busy[voice] = true;
+			//so it doesn't get detected as "in release" in the next block:
+			m_actual_voice_pointers[voice]->setReleaseInactiveBeforeStart();
+			removeFromKillList(voice);
+			updateVoiceHistory(voice);
+			p_voices[num_voices++] = voice;
+			if (num_voices >= p_unison) {
+				return num_voices;
 			}
 		}
 
-		// look for voices in release
-		for (int i = VOICES - 1; i >= 0; --i) {
-			if (m_actual_voice_pointers[m_voice_history[i]]->isInRelease()){
-				removeFromKillList(m_voice_history[i]);
-				ret.push_back(m_voice_history[i]);
-				updateVoiceHistory(m_voice_history[i]);
-				DBG("Stole voice " + std::to_string(m_voice_history[i]) + " out of release");
-				if (ret.size() >= p_unison) {
-					return ret;
+		// look for voices in release, oldest first. Voices taken here move to the front, so the walk stops at the
+		// voice which was the newest when it started
+		const int newest = m_newest;
+		for (int voice = m_oldest; voice != -1;) {
+			const int newer = voice == newest ? -1 : m_newer[voice];
+			if (m_actual_voice_pointers[voice]->isInRelease()) {
+				removeFromKillList(voice);
+				p_voices[num_voices++] = voice;
+				updateVoiceHistory(voice);
+				if (num_voices >= p_unison) {
+					return num_voices;
 				}
-				// shift, since voice history was updated
-				++i;
 			}
+			voice = newer;
 		}
 
 		// we still need voices, so we steal them
-		int voices_to_steal = p_unison - ret.size();
-		for (int steal = 0; steal < voices_to_steal; ++steal) {
-			//we update history at the end of loop, so [VOICES - 1] is different every time
-			DBG("Voice manager STOLE voice " + std::to_string(m_voice_history[VOICES - 1]));
-			removeFromKillList(m_voice_history[VOICES - 1]);
-			ret.push_back(m_voice_history[VOICES - 1]);
-			updateVoiceHistory(m_voice_history[VOICES - 1]);
+		while (num_voices < p_unison) {
+			//we update history at the end of loop, so the oldest voice is different every time
+			const int oldest_voice = getOldestVoiceIndex();
+			removeFromKillList(oldest_voice);
+			p_voices[num_voices++] = oldest_voice;
+			updateVoiceHistory(oldest_voice);
 		}
-		return ret;
+		return num_voices;
 	}
 
-	int getNewestVoiceIndex() {
-		return m_voice_history[0];
+	int getNewestVoiceIndex() const {
+		return m_newest_voice;
 	}
 
-	// marks a voice as free again
+	// oldest voice within the polyphony
+	int getOldestVoiceIndex() const {
+		return m_oldest;
+	}
+
+	// only the first p_voices voices get new notes, voices above that which are still playing just end
+	void setPolyphony(int p_voices) {
+		const int polyphony = p_voices < VOICES_MIN ? VOICES_MIN : (p_voices > VOICES ? VOICES : p_voices);
+		if (polyphony == m_polyphony) {
+			return;
+		}
+		// the voice history only holds the voices within the polyphony. Keep the order of the ones which stay and
+		// append new ones as the oldest
+		int order[VOICES];
+		int size = 0;
+		for (int voice = m_newest; voice != -1; voice = m_older[voice]) {
+			if (voice < polyphony) {
+				order[size++] = voice;
+			}
+		}
+		for (int voice = m_polyphony; voice < polyphony; ++voice) {
+			order[size++] = voice;
+		}
+		m_polyphony = polyphony;
+		rebuildVoiceHistory(order, size);
+	}
+
+	int getPolyphony() const {
+		return m_polyphony;
+	}
+
+	// the playing voices in the order they were started, so per voice work can skip the idle ones
+	void addActiveVoice(int p_voice) {
+		for (int active = 0; active < m_num_active_voices; ++active) {
+			if (m_active_voices[active] == p_voice) {
+				return;
+			}
+		}
+		m_active_voices[m_num_active_voices++] = p_voice;
+	}
+
+	// removes the entry at p_index of the active voice list
+	void removeActiveVoiceAt(int p_index) {
+		for (int active = p_index; active < m_num_active_voices - 1; ++active) {
+			m_active_voices[active] = m_active_voices[active + 1];
+		}
+		--m_num_active_voices;
+	}
+
+	const int *getActiveVoices() const {
+		return m_active_voices;
+	}
+
+	int getNumActiveVoices() const {
+		return m_num_active_voices;
+	}
+
+	// marks a voice as free again, the processor calls this when the voice ended
 	void freeVoice(int p_voice) {
 		voice_busy[p_voice] = false;
-		DBG("Voice manager freed voice " + std::to_string(p_voice));
+		m_free_voices |= uint64_t(1) << p_voice;
 	}
 
 	void setSustainActive(bool p_active) {
@@ -744,49 +904,43 @@ public:
 	// adds to killlist to be killed after sustain pedal gets lifted
 	void addToKillList(int p_voice, int p_note) {
 		m_kill_list_note[p_voice] = p_note;
-		m_kill_list[p_voice]      = true;
+		m_kill_list |= uint64_t(1) << p_voice;
 	}
 
 	void removeFromKillList(int p_voice) {
-		m_kill_list[p_voice] = false;
+		m_kill_list &= ~(uint64_t(1) << p_voice);
 	}
 
-	bool isOnKillList(int p_voice) {
-		return m_kill_list[p_voice];
+	bool isOnKillList(int p_voice) const {
+		return (m_kill_list >> p_voice) & 1;
 	}
 
 	void clearKillList() {
-		for (int voice = 0; voice < VOICES; ++voice) {
-			m_kill_list[voice] = false;
-		}
+		m_kill_list = 0;
 	}
 
+	// moves p_next_voice to the front of the voice history
 	void updateVoiceHistory(int p_next_voice) {
-		int index = 0;
-		while (p_next_voice != m_voice_history[index]) {
-			++index;
+		m_newest_voice = p_next_voice;
+		if (p_next_voice >= m_polyphony || p_next_voice == m_newest) {
+			return;
 		}
 
-		// p_next_voice was at position index, move all above one down:
-		for (int voice = index; voice > 0; --voice) {
-			m_voice_history[voice] = m_voice_history[voice - 1];
+		// unlink, the voice can't be the newest one here
+		const int newer = m_newer[p_next_voice];
+		const int older = m_older[p_next_voice];
+		m_older[newer]  = older;
+		if (older == -1) {
+			m_oldest = newer;
+		} else {
+			m_newer[older] = newer;
 		}
 
-		// now set new as newest value:
-		m_voice_history[0] = p_next_voice;
-
-		// DBG(std::to_string(m_voice_history[0]) + " " +
-		//     std::to_string(m_voice_history[1]) + " " +
-		//     std::to_string(m_voice_history[2]) + " " +
-		//     std::to_string(m_voice_history[3]) + " " +
-		//     std::to_string(m_voice_history[4]) + " " +
-		//     std::to_string(m_voice_history[5]) + " " +
-		//     std::to_string(m_voice_history[6]) + " " +
-		//     std::to_string(m_voice_history[7]) + " " +
-		//     std::to_string(m_voice_history[8]) + " " +
-		//     std::to_string(m_voice_history[9]) + " " +
-		//     std::to_string(m_voice_history[10]) + " " +
-		//     std::to_string(m_voice_history[11]));
+		// and set new as newest value
+		m_newer[p_next_voice] = -1;
+		m_older[p_next_voice] = m_newest;
+		m_newer[m_newest]     = p_next_voice;
+		m_newest              = p_next_voice;
 	}
 
 	bool setMonoPolyLegato(PlayModes p_mode) {
@@ -798,11 +952,16 @@ public:
 	}
 
 	void reset() {
+		int order[VOICES];
 		for (int voice = 0; voice < VOICES; ++voice) {
-			m_voice_history[voice] = voice;
-			voice_busy[voice]      = false;
-			m_kill_list[voice]     = false;
+			order[voice]      = voice;
+			voice_busy[voice] = false;
 		}
+		rebuildVoiceHistory(order, m_polyphony);
+		m_newest_voice         = 0;
+		m_free_voices          = ~uint64_t(0);
+		m_kill_list            = 0;
+		m_num_active_voices    = 0;
 		m_sustain_active       = false;
 		m_sustain_active_float = 0.f;
 	}
@@ -813,13 +972,50 @@ public:
 
 	float m_sustain_active_float = 0; //for modulation, "copy" of the bool
 protected:
+	// free voices and the kill list are kept as one bit per voice
+	static_assert(VOICES <= 64, "the voice manager keeps one bit per voice in a 64 bit mask");
+
+	static inline int lowestBit(uint64_t p_bits) {
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, p_bits);
+		return (int)index;
+#else
+		return __builtin_ctzll(p_bits);
+#endif
+	}
+
+	inline uint64_t polyphonyMask() const {
+		return m_polyphony >= 64 ? ~uint64_t(0) : (uint64_t(1) << m_polyphony) - 1;
+	}
+
+	// links the voices in p_order (newest first) into the voice history
+	void rebuildVoiceHistory(const int *p_order, int p_size) {
+		for (int index = 0; index < p_size; ++index) {
+			m_newer[p_order[index]] = index == 0 ? -1 : p_order[index - 1];
+			m_older[p_order[index]] = index == p_size - 1 ? -1 : p_order[index + 1];
+		}
+		m_newest = p_order[0];
+		m_oldest = p_order[p_size - 1];
+	}
 
 	bool m_sustain_active = false;
 
 	PlayModes m_mono_poly_legato = PlayModes::Poly;
-	// used to determine oldest voice for stealing
-	std::vector<int> m_voice_history;
-
-	bool m_kill_list[VOICES] = {0};
+	// used to determine oldest voice for stealing: the voices within the polyphony as a doubly linked list from the
+	// newest (m_newest) to the oldest (m_oldest), -1 ends the list
+	int m_newer[VOICES];
+	int m_older[VOICES];
+	int m_newest = 0;
+	int m_oldest = 0;
+	// the last started voice, this can be above the polyphony if it was lowered since
+	int m_newest_voice = 0;
+
+	uint64_t m_free_voices = ~uint64_t(0);
+	uint64_t m_kill_list   = 0;
 	int m_kill_list_note[VOICES];
+
+	int m_active_voices[VOICES] = {0};
+	int m_num_active_voices     = 0;
+	int m_polyphony             = VOICES_DEFAULT;
 };
\ No newline at end of file
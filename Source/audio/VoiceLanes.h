@@ -0,0 +1,123 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+// number of voices which are rendered side by side in one lane group
+#define VOICE_LANES 4
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define ODIN_VOICE_LANES_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ODIN_VOICE_LANES_SSE2 1
+#endif
+
+/**
+ * One double per voice of a lane group. The voice DSP runs in double precision, so this is a single AVX register,
+ * two SSE2 registers or a plain array the compiler can vectorize on its own (NEON on arm64). All loads and stores
+ * expect VOICE_LANES doubles aligned to 32 bytes.
+ */
+struct VoiceLaneVector {
+#if ODIN_VOICE_LANES_AVX
+	__m256d v;
+
+	static inline VoiceLaneVector load(const double *p_data) {
+		return {_mm256_load_pd(p_data)};
+	}
+	static inline VoiceLaneVector broadcast(double p_value) {
+		return {_mm256_set1_pd(p_value)};
+	}
+	inline void store(double *p_data) const {
+		_mm256_store_pd(p_data, v);
+	}
+	inline VoiceLaneVector operator+(const VoiceLaneVector &p_other) const {
+		return {_mm256_add_pd(v, p_other.v)};
+	}
+	inline VoiceLaneVector operator-(const VoiceLaneVector &p_other) const {
+		return {_mm256_sub_pd(v, p_other.v)};
+	}
+	inline VoiceLaneVector operator*(const VoiceLaneVector &p_other) const {
+		return {_mm256_mul_pd(v, p_other.v)};
+	}
+#elif ODIN_VOICE_LANES_SSE2
+	__m128d lo;
+	__m128d hi;
+
+	static inline VoiceLaneVector load(const double *p_data) {
+		return {_mm_load_pd(p_data), _mm_load_pd(p_data + 2)};
+	}
+	static inline VoiceLaneVector broadcast(double p_value) {
+		return {_mm_set1_pd(p_value), _mm_set1_pd(p_value)};
+	}
+	inline void store(double *p_data) const {
+		_mm_store_pd(p_data, lo);
+		_mm_store_pd(p_data + 2, hi);
+	}
+	inline VoiceLaneVector operator+(const VoiceLaneVector &p_other) const {
+		return {_mm_add_pd(lo, p_other.lo), _mm_add_pd(hi, p_other.hi)};
+	}
+	inline VoiceLaneVector operator-(const VoiceLaneVector &p_other) const {
+		return {_mm_sub_pd(lo, p_other.lo), _mm_sub_pd(hi, p_other.hi)};
+	}
+	inline VoiceLaneVector operator*(const VoiceLaneVector &p_other) const {
+		return {_mm_mul_pd(lo, p_other.lo), _mm_mul_pd(hi, p_other.hi)};
+	}
+#else
+	double v[VOICE_LANES];
+
+	static inline VoiceLaneVector load(const double *p_data) {
+		VoiceLaneVector ret;
+		for (int lane = 0; lane < VOICE_LANES; ++lane) {
+			ret.v[lane] = p_data[lane];
+		}
+		return ret;
+	}
+	static inline VoiceLaneVector broadcast(double p_value) {
+		VoiceLaneVector ret;
+		for (int lane = 0; lane < VOICE_LANES; ++lane) {
+			ret.v[lane] = p_value;
+		}
+		return ret;
+	}
+	inline void store(double *p_data) const {
+		for (int lane = 0; lane < VOICE_LANES; ++lane) {
+			p_data[lane] = v[lane];
+		}
+	}
+	inline VoiceLaneVector operator+(const VoiceLaneVector &p_other) const {
+		VoiceLaneVector ret;
+		for (int lane = 0; lane < VOICE_LANES; ++lane) {
+			ret.v[lane] = v[lane] + p_other.v[lane];
+		}
+		return ret;
+	}
+	inline VoiceLaneVector operator-(const VoiceLaneVector &p_other) const {
+		VoiceLaneVector ret;
+		for (int lane = 0; lane < VOICE_LANES; ++lane) {
+			ret.v[lane] = v[lane] - p_other.v[lane];
+		}
+		return ret;
+	}
+	inline VoiceLaneVector operator*(const VoiceLaneVector &p_other) const {
+		VoiceLaneVector ret;
+		for (int lane = 0; lane < VOICE_LANES; ++lane) {
+			ret.v[lane] = v[lane] * p_other.v[lane];
+		}
+		return ret;
+	}
+#endif
+};
@@ -0,0 +1,200 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "VoiceRenderPool.h"
+#include "../RealtimeChecker.h"
+
+#include <chrono>
+#include <thread>
+#if JUCE_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// how long an idle worker keeps checking for a new batch before it goes to sleep. Within a host block the batches
+// follow each other quickly, so the workers stay awake and only need to be woken once per block
+#define VOICE_RENDER_IDLE_SPIN_MICROSECONDS 250
+
+VoiceRenderWorker::VoiceRenderWorker(VoiceRenderPool &p_pool, int p_thread_index) :
+    juce::Thread("VoiceRenderWorker" + juce::String(p_thread_index)),
+    m_pool(p_pool),
+    m_thread_index(p_thread_index) {
+}
+
+void VoiceRenderWorker::run() {
+	using Clock                = std::chrono::steady_clock;
+	uint32 last_batch          = (uint32)(m_pool.m_state.load() >> 32);
+	Clock::time_point idle_end = Clock::now() + std::chrono::microseconds(VOICE_RENDER_IDLE_SPIN_MICROSECONDS);
+
+	while (!threadShouldExit()) {
+		if (m_priority_version != m_pool.m_priority_version.load(std::memory_order_acquire)) {
+			adoptAudioThreadPriority();
+		}
+		if (m_pool.helpWithBatch(m_thread_index, last_batch)) {
+			idle_end = Clock::now() + std::chrono::microseconds(VOICE_RENDER_IDLE_SPIN_MICROSECONDS);
+			continue;
+		}
+		if (Clock::now() < idle_end) {
+			std::this_thread::yield();
+			continue;
+		}
+
+		// announce the sleep first and check once more, so a batch published in between is not missed
+		m_sleeping.store(true);
+		if (!m_pool.helpWithBatch(m_thread_index, last_batch)) {
+			m_wake_event.wait(100);
+		}
+		m_sleeping.store(false);
+		idle_end = Clock::now() + std::chrono::microseconds(VOICE_RENDER_IDLE_SPIN_MICROSECONDS);
+	}
+}
+
+void VoiceRenderWorker::adoptAudioThreadPriority() {
+	m_priority_version = m_pool.m_priority_version.load(std::memory_order_acquire);
+	const int priority = m_pool.m_audio_thread_priority.load(std::memory_order_relaxed);
+#if JUCE_WINDOWS
+	SetThreadPriority(GetCurrentThread(), priority);
+#else
+	sched_param param;
+	param.sched_priority = priority;
+	if (pthread_setschedparam(pthread_self(), m_pool.m_audio_thread_policy.load(std::memory_order_relaxed), &param)) {
+		DBG("VoiceRenderWorker could not take over the priority of the audio thread");
+	}
+#endif
+}
+
+void VoiceRenderWorker::wakeUp() {
+	if (m_sleeping.load()) {
+		m_wake_event.signal();
+	}
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+
+VoiceRenderPool::VoiceRenderPool() {
+	for (int worker = 0; worker < VOICE_RENDER_THREADS_MAX - 1; ++worker) {
+		m_workers[worker] = std::make_unique<VoiceRenderWorker>(*this, worker + 1);
+	}
+}
+
+VoiceRenderPool::~VoiceRenderPool() {
+	setNumHelperThreads(0);
+}
+
+void VoiceRenderPool::setNumHelperThreads(int p_num_helpers) {
+	p_num_helpers = juce::jlimit(0, VOICE_RENDER_THREADS_MAX - 1, p_num_helpers);
+	if (p_num_helpers == m_num_helpers.load()) {
+		return;
+	}
+
+	// lower the count first, so the audio thread stops waking the threads which are about to be stopped. Threads
+	// which are stopped finish the job they are on before exiting, everything else is picked up by the audio thread
+	m_num_helpers.store(juce::jmin(p_num_helpers, m_num_helpers.load()));
+	for (int worker = 0; worker < VOICE_RENDER_THREADS_MAX - 1; ++worker) {
+		if (worker < p_num_helpers) {
+			if (!m_workers[worker]->isThreadRunning()) {
+				// the workers take over the priority of the audio thread when it runs the next batch
+				m_workers[worker]->startThread();
+				m_record_priority.store(true);
+			}
+		} else {
+			m_workers[worker]->signalThreadShouldExit();
+			m_workers[worker]->wakeUp();
+			m_workers[worker]->stopThread(1000);
+		}
+	}
+	m_num_helpers.store(p_num_helpers);
+	DBG("VoiceRenderPool uses " << p_num_helpers << " helper threads");
+}
+
+int VoiceRenderPool::getNumHelperThreads() const {
+	return m_num_helpers.load();
+}
+
+void VoiceRenderPool::run(const int *p_jobs, int p_num_jobs) {
+	jassert(p_num_jobs <= VOICES);
+
+	if (m_record_priority.exchange(false)) {
+		recordAudioThreadPriority();
+	}
+
+	for (int job = 0; job < p_num_jobs; ++job) {
+		m_jobs[job] = p_jobs[job];
+	}
+	m_jobs_done.store(0);
+	++m_batch;
+	m_state.store(((uint64)m_batch << 32) | ((uint64)p_num_jobs << 16));
+
+	const int num_helpers = m_num_helpers.load();
+	{
+		// a sleeping worker is woken through an event, which takes a lock. This happens at most once per block
+		RealtimeChecker::ScopedPermit permit;
+		for (int worker = 0; worker < num_helpers; ++worker) {
+			m_workers[worker]->wakeUp();
+		}
+	}
+
+	workOnJobs(0);
+
+	// wait for the jobs other threads are still busy with
+	while (m_jobs_done.load() < p_num_jobs) {
+		std::this_thread::yield();
+	}
+}
+
+void VoiceRenderPool::recordAudioThreadPriority() {
+#if JUCE_WINDOWS
+	m_audio_thread_priority.store(GetThreadPriority(GetCurrentThread()), std::memory_order_relaxed);
+#else
+	int policy = 0;
+	sched_param param;
+	if (pthread_getschedparam(pthread_self(), &policy, &param)) {
+		return;
+	}
+	m_audio_thread_policy.store(policy, std::memory_order_relaxed);
+	m_audio_thread_priority.store(param.sched_priority, std::memory_order_relaxed);
+#endif
+	m_priority_version.fetch_add(1, std::memory_order_release);
+}
+
+bool VoiceRenderPool::helpWithBatch(int p_thread_index, uint32 &p_last_batch) {
+	const uint32 batch = (uint32)(m_state.load() >> 32);
+	if (batch == p_last_batch) {
+		return false;
+	}
+	p_last_batch = batch;
+	// the workers render voices, so they are held to the same rules as the audio thread
+	RealtimeChecker::ScopedSection realtime_section;
+	workOnJobs(p_thread_index);
+	return true;
+}
+
+void VoiceRenderPool::workOnJobs(int p_thread_index) {
+	while (true) {
+		// job index and job count come from the same word, so they always belong to the same batch
+		const uint64 state = m_state.fetch_add(1);
+		const int job      = (int)(state & 0xffff);
+		const int num_jobs = (int)((state >> 16) & 0xffff);
+		if (job >= num_jobs) {
+			return;
+		}
+
+		renderJob(m_jobs[job], p_thread_index);
+		m_jobs_done.fetch_add(1);
+	}
+}
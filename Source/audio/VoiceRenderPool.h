@@ -0,0 +1,93 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../GlobalIncludes.h"
+
+#include <array>
+#include <atomic>
+
+// the audio thread counts as thread 0, so this allows for up to 7 helper threads
+static constexpr auto VOICE_RENDER_THREADS_MAX = 8;
+
+class VoiceRenderPool;
+
+class VoiceRenderWorker : public juce::Thread {
+public:
+	VoiceRenderWorker(VoiceRenderPool &p_pool, int p_thread_index);
+
+	void run() override;
+	// wakes the worker up if it went to sleep waiting for work
+	void wakeUp();
+
+private:
+	// takes over the scheduling the pool recorded for the audio thread
+	void adoptAudioThreadPriority();
+
+	VoiceRenderPool &m_pool;
+	const int m_thread_index;
+	int m_priority_version = 0;
+	std::atomic<bool> m_sleeping{false};
+	juce::WaitableEvent m_wake_event;
+};
+
+/**
+ * Renders a batch of jobs (the active voices of a sub-block) on the calling thread and a number of helper threads.
+ * Every thread grabs the next job from a shared counter until none are left, so threads which finish early take over
+ * the jobs the others did not get to yet. The calling thread always helps out, so a batch never waits for a helper
+ * thread to wake up, only for jobs which are already in progress. renderJob gets the job and the index of the thread
+ * it runs on, so it can write to a per-thread buffer.
+ */
+class VoiceRenderPool {
+public:
+	VoiceRenderPool();
+	~VoiceRenderPool();
+
+	// starts p_num_helpers threads (clamped to VOICE_RENDER_THREADS_MAX - 1), 0 stops all of them. Call from the message thread only
+	void setNumHelperThreads(int p_num_helpers);
+	int getNumHelperThreads() const;
+
+	// runs renderJob for every entry of p_jobs and returns once all of them are done. Call from the audio thread only
+	void run(const int *p_jobs, int p_num_jobs);
+
+	std::function<void(int, int)> renderJob = [](int p_job, int p_thread_index) {};
+
+private:
+	friend class VoiceRenderWorker;
+
+	// called by the workers, returns true if there was a new batch to help with
+	bool helpWithBatch(int p_thread_index, uint32 &p_last_batch);
+	void workOnJobs(int p_thread_index);
+	// remembers the scheduling of the calling (audio) thread for the workers
+	void recordAudioThreadPriority();
+
+	std::array<std::unique_ptr<VoiceRenderWorker>, VOICE_RENDER_THREADS_MAX - 1> m_workers;
+	std::atomic<int> m_num_helpers{0};
+
+	// batch index (bits 32-63), number of jobs (bits 16-31) and next job to hand out (bits 0-15) in one word, so a
+	// thread which is late from the last batch can't grab a job it checked against an outdated job count
+	std::atomic<uint64> m_state{0};
+	std::atomic<int> m_jobs_done{0};
+	std::array<int, VOICES> m_jobs;
+	uint32 m_batch = 0;
+
+	// the workers start at normal priority and run at the one of the audio thread once run() was called, a new
+	// version tells them to adopt it again
+	std::atomic<bool> m_record_priority{false};
+	std::atomic<int> m_priority_version{0};
+	std::atomic<int> m_audio_thread_policy{0};
+	std::atomic<int> m_audio_thread_priority{0};
+};
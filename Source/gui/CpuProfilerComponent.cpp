@@ -0,0 +1,82 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "CpuProfilerComponent.h"
+
+#include <algorithm>
+
+CpuProfilerComponent::CpuProfilerComponent(CpuProfiler &p_profiler) : m_profiler(p_profiler) {
+	// only a readout, the controls below stay usable
+	setInterceptsMouseClicks(false, false);
+}
+
+CpuProfilerComponent::~CpuProfilerComponent() {
+	m_profiler.setEnabled(false);
+}
+
+void CpuProfilerComponent::setVisibleAndStartTimer(bool p_set_visible) {
+	m_profiler.setEnabled(p_set_visible);
+	if (p_set_visible) {
+		startTimer(CPU_PROFILER_TIMER_MILLISECS);
+	} else {
+		stopTimer();
+	}
+	setVisible(p_set_visible);
+}
+
+void CpuProfilerComponent::timerCallback() {
+	m_total_load = m_profiler.getTotalLoad();
+
+	m_num_rows = 0;
+	for (int section = 0; section < CpuProfiler::NUM_SECTIONS; ++section) {
+		m_loads[section] = m_profiler.getLoad(section);
+		if (m_loads[section] >= CPU_PROFILER_MIN_LOAD) {
+			m_sections[m_num_rows++] = section;
+		}
+	}
+	// most expensive first
+	std::sort(m_sections, m_sections + m_num_rows, [&](int p_a, int p_b) { return m_loads[p_a] > m_loads[p_b]; });
+	m_num_rows = jmin(m_num_rows, CPU_PROFILER_MAX_ROWS);
+
+	repaint();
+}
+
+void CpuProfilerComponent::paint(juce::Graphics &g) {
+	g.setColour(juce::Colours::black.withAlpha(0.75f));
+	g.fillRoundedRectangle(getLocalBounds().toFloat(), proportionOfHeight(0.03f));
+
+	const float row_height = getHeight() / (float)(CPU_PROFILER_MAX_ROWS + 1);
+	auto area              = getLocalBounds().toFloat().reduced(row_height * 0.3f, 0.f);
+	g.setFont(Helpers::getAldrichFont(row_height * 0.7f));
+
+	auto title = area.removeFromTop(row_height);
+	g.setColour(juce::Colours::white);
+	g.drawText("CPU", title, juce::Justification::centredLeft, false);
+	g.drawText(juce::String(m_total_load, 1) + " %", title, juce::Justification::centredRight, false);
+
+	for (int row = 0; row < m_num_rows; ++row) {
+		const int section = m_sections[row];
+		auto row_area     = area.removeFromTop(row_height);
+
+		// bars are relative to the whole budget, so they show how close the patch gets to dropouts
+		const float bar_width = row_area.getWidth() * jlimit(0.f, 1.f, m_loads[section] / 100.f);
+		g.setColour(juce::Colours::lightblue.withAlpha(0.3f));
+		g.fillRect(row_area.withWidth(bar_width).reduced(0.f, row_height * 0.1f));
+
+		g.setColour(juce::Colours::lightgrey);
+		g.drawText(CpuProfiler::getSectionName(section), row_area, juce::Justification::centredLeft, false);
+		g.drawText(juce::String(m_loads[section], 1) + " %", row_area, juce::Justification::centredRight, false);
+	}
+}
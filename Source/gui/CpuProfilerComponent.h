@@ -0,0 +1,44 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../CpuProfiler.h"
+#include "../GlobalIncludes.h"
+
+#define CPU_PROFILER_TIMER_MILLISECS 250
+// sections below this load (in percent) are left out of the list
+#define CPU_PROFILER_MIN_LOAD 0.05f
+#define CPU_PROFILER_MAX_ROWS 12
+
+// overlay listing the most expensive sections of processBlock, shown from the settings menu
+class CpuProfilerComponent : public juce::Component, public juce::Timer {
+public:
+	CpuProfilerComponent(CpuProfiler &p_profiler);
+	~CpuProfilerComponent();
+
+	void paint(juce::Graphics &g) override;
+	void timerCallback() override;
+	// the profiler only runs while the overlay is visible
+	void setVisibleAndStartTimer(bool p_set_visible);
+
+private:
+	CpuProfiler &m_profiler;
+
+	float m_total_load = 0.f;
+	int m_sections[CpuProfiler::NUM_SECTIONS];
+	float m_loads[CpuProfiler::NUM_SECTIONS];
+	int m_num_rows = 0;
+};
@@ -15,98 +15,31 @@
 
 #include "ModMatrix.h"
 
+#include <algorithm>
+
 void ModMatrixRow::setSourcesAndDestinations(ModSources *p_source, ModDestinations *p_destination) {
 	m_sources      = p_source;
 	m_destinations = p_destination;
 }
 
-void ModMatrixRow::applyModulation() {
-
-	if (m_active_1) {
-		// poly destination -> #VOICES modulations
-		if (m_destination_1_poly) {
-			for (int voice = 0; voice < VOICES; ++voice) {
-				if (m_scale) {
-					if (m_scale_amount >= 0) {
-						*(m_destination_1_value[voice]) += (*m_source_value[voice]) * m_mod_amount_1 *
-						                                   fabs(m_mod_amount_1) *
-						                                   (1 + (*m_scale_value[voice] - 1) * m_scale_amount);
-					} else {
-						*(m_destination_1_value[voice]) += (*m_source_value[voice]) * m_mod_amount_1 *
-						                                   fabs(m_mod_amount_1) *
-						                                   (1 + fabs(*m_scale_value[voice]) * m_scale_amount);
-					}
-				} else {
-					// DBG("MOD SLOT ACTIVE");
-					*(m_destination_1_value[voice]) += (*m_source_value[voice]) * m_mod_amount_1 * fabs(m_mod_amount_1);
-				}
-			}
-		} else // mono destination
-		{
-			// use most recent voice for poly, for mono all #VOICES are identical so it
-			// doesnt matter
-			if (m_scale) {
-				if (m_scale_amount >= 0) {
-					*(m_destination_1_value[0]) += (*m_source_value[m_most_recent_voice]) * m_mod_amount_1 *
-					                               fabs(m_mod_amount_1) *
-					                               (1 + (*m_scale_value[m_most_recent_voice] - 1) * m_scale_amount);
-				} else {
-					*(m_destination_1_value[0]) += (*m_source_value[m_most_recent_voice]) * m_mod_amount_1 *
-					                               fabs(m_mod_amount_1) *
-					                               (1 + fabs(*m_scale_value[m_most_recent_voice]) * m_scale_amount);
-				}
-			} else {
-				//DBG("dest before: " + std::to_string(*(m_destination_1_value[0])));
-				//DBG("mod amount: " + std::to_string(m_mod_amount_1));
-				//DBG("rec voice: " + std::to_string(m_most_recent_voice));
-				//DBG("source: " + std::to_string((*m_source_value[m_most_recent_voice])));
-
-				*(m_destination_1_value[0]) +=
-				    (*m_source_value[m_most_recent_voice]) * m_mod_amount_1 * fabs(m_mod_amount_1);
-				//DBG("dest after: " + std::to_string(*(m_destination_1_value[0])));
-			}
-		}
-	}
-
-	if (m_active_2) {
-		// poly destination -> #VOICES modulations
-		if (m_destination_2_poly) {
-			for (int voice = 0; voice < VOICES; ++voice) {
-				if (m_scale) {
-					if (m_scale_amount >= 0) {
-						*(m_destination_2_value[voice]) += (*m_source_value[voice]) * m_mod_amount_2 *
-						                                   fabs(m_mod_amount_2) *
-						                                   (1 + (*m_scale_value[voice] - 1) * m_scale_amount);
-					} else {
-						*(m_destination_2_value[voice]) += (*m_source_value[voice]) * m_mod_amount_2 *
-						                                   fabs(m_mod_amount_2) *
-						                                   (1 + fabs(*m_scale_value[voice]) * m_scale_amount);
-					}
-				} else {
-					// DBG("MOD SLOT ACTIVE");
-					*(m_destination_2_value[voice]) += (*m_source_value[voice]) * m_mod_amount_2 * fabs(m_mod_amount_2);
-				}
-			}
-		} else // mono destination
-		{
-			// use most recent voice for poly, for mono all #VOICES are identical so it
-			// doesnt matter
-			if (m_scale) {
-				if (m_scale_amount >= 0) {
-					*(m_destination_2_value[0]) += (*m_source_value[m_most_recent_voice]) * m_mod_amount_2 *
-					                               fabs(m_mod_amount_2) *
-					                               (1 + (*m_scale_value[m_most_recent_voice] - 1) * m_scale_amount);
-				} else {
-					*(m_destination_2_value[0]) += (*m_source_value[m_most_recent_voice]) * m_mod_amount_2 *
-					                               fabs(m_mod_amount_2) *
-					                               (1 + fabs(*m_scale_value[m_most_recent_voice]) * m_scale_amount);
-				}
-			} else {
-				*(m_destination_2_value[0]) +=
-				    (*m_source_value[m_most_recent_voice]) * m_mod_amount_2 * fabs(m_mod_amount_2);
-			}
-		}
+int ModMatrixRow::getRoutes(ModRoute *p_routes) const {
+	int num_routes = 0;
+	for (int slot = 0; slot < 2; ++slot) {
+		if (!(slot == 0 ? m_active_1 : m_active_2)) {
+			continue;
+		}
+		ModRoute &route    = p_routes[num_routes++];
+		route.source       = m_source_value;
+		route.scale        = m_scale_value;
+		route.destination  = slot == 0 ? m_destination_1_value : m_destination_2_value;
+		route.amount       = slot == 0 ? m_mod_amount_1 : m_mod_amount_2;
+		route.amount_abs   = fabs(route.amount);
+		route.scale_amount = m_scale_amount;
+		route.scale_mode   = !m_scale ? MOD_SCALE_NONE : (m_scale_amount >= 0 ? MOD_SCALE_POSITIVE : MOD_SCALE_NEGATIVE);
+		route.poly         = slot == 0 ? m_destination_1_poly : m_destination_2_poly;
+		route.audio_rate   = m_audio_rate;
 	}
+	return num_routes;
 }
 
 void ModMatrixRow::setModSource(int p_source) {
@@ -162,7 +95,7 @@ void ModMatrixRow::setModSource(int p_source, float **p_source_pointers, int &p_
 		break;
 	case 203:
 		for (int voice = 0; voice < VOICES; ++voice) {
-			p_source_pointers[voice] = m_sources->global_adsr;
+			p_source_pointers[voice] = m_sources->voice[voice].global_adsr;
 		}
 		break;
 	case 300:
@@ -182,28 +115,28 @@ void ModMatrixRow::setModSource(int p_source, float **p_source_pointers, int &p_
 		break;
 	case 303:
 		for (int voice = 0; voice < VOICES; ++voice) {
-			p_source_pointers[voice] = m_sources->global_lfo;
+			p_source_pointers[voice] = m_sources->voice[voice].global_lfo;
 		}
 		break;
 
 	case 400:
 		for (int voice = 0; voice < VOICES; ++voice) {
-			p_source_pointers[voice] = m_sources->x;
+			p_source_pointers[voice] = m_sources->voice[voice].x;
 		}
 		break;
 	case 401:
 		for (int voice = 0; voice < VOICES; ++voice) {
-			p_source_pointers[voice] = m_sources->y;
+			p_source_pointers[voice] = m_sources->voice[voice].y;
 		}
 		break;
 	case 402:
 		for (int voice = 0; voice < VOICES; ++voice) {
-			p_source_pointers[voice] = m_sources->modwheel;
+			p_source_pointers[voice] = m_sources->voice[voice].modwheel;
 		}
 		break;
 	case 403:
 		for (int voice = 0; voice < VOICES; ++voice) {
-			p_source_pointers[voice] = m_sources->pitchwheel;
+			p_source_pointers[voice] = m_sources->voice[voice].pitchwheel;
 		}
 		break;
 
@@ -272,7 +205,8 @@ void ModMatrixRow::setModSource(int p_source, float **p_source_pointers, int &p_
 		break;
 	default:
 		//use const as default fallback (avoid segfaults down the line...):
-		DBG("ERROR: Unknown modulation source was set: " + std::to_string(p_source));
+		// the rows are set on the audio thread, so this is not logged
+		jassertfalse;
 		for (int voice = 0; voice < VOICES; ++voice) {
 			p_source_pointers[voice] = m_sources->constant;
 		}
@@ -1013,7 +947,7 @@ void ModMatrixRow::setModDestination(int p_destination,
 		//none
 		break;
 	default:
-		DBG("ERROR: Unknown modulation dest was set: " + std::to_string(p_destination));
+		jassertfalse;
 		// use osc3 spread as fallback (the most obscure I could find :D )
 		for (int voice = 0; voice < VOICES; ++voice) {
 			p_destination_pointers[voice] = &(m_destinations->voice[voice].osc[2].spread);
@@ -1031,6 +965,9 @@ void ModMatrixRow::setModDestination(int p_destination,
 void ModMatrixRow::checkRowActive() {
 	m_active_1 = (m_source && m_destination_1);
 	m_active_2 = (m_source && m_destination_2);
+
+	// oscillator and filter outputs
+	m_audio_rate = (m_source >= 100 && m_source < 200) || (m_scale >= 100 && m_scale < 200);
 	//DBG("src " + std::to_string(m_source) + " dest " + std::to_string(m_destination_1) +
 	//    " act: " + std::to_string(m_active_1));
 }
@@ -1065,10 +1002,108 @@ bool ModMatrixRow::usesADSR1() // global env
 //=================== MODMATRIX ===========================
 //=========================================================
 
-void ModMatrix::applyModulation() {
+// one kernel per scale mode, so the inner loops don't branch
+template <int SCALE_MODE>
+static inline void applyRoutes(const ModRouteList &p_list, int p_source_voice, int p_destination_voice) {
+	for (int index = 0; index < p_list.size; ++index) {
+		const ModRoute &route = p_list.route[index];
+		float value           = (*route.source[p_source_voice]) * route.amount * route.amount_abs;
+		if (SCALE_MODE == MOD_SCALE_POSITIVE) {
+			value *= (1 + (*route.scale[p_source_voice] - 1) * route.scale_amount);
+		} else if (SCALE_MODE == MOD_SCALE_NEGATIVE) {
+			value *= (1 + fabs(*route.scale[p_source_voice]) * route.scale_amount);
+		}
+		*route.destination[p_destination_voice] += value;
+	}
+}
+
+static inline void applyRouteLists(const ModRouteList *p_lists, int p_source_voice, int p_destination_voice) {
+	applyRoutes<MOD_SCALE_NONE>(p_lists[MOD_SCALE_NONE], p_source_voice, p_destination_voice);
+	applyRoutes<MOD_SCALE_POSITIVE>(p_lists[MOD_SCALE_POSITIVE], p_source_voice, p_destination_voice);
+	applyRoutes<MOD_SCALE_NEGATIVE>(p_lists[MOD_SCALE_NEGATIVE], p_source_voice, p_destination_voice);
+}
+
+void ModMatrix::applyModulationMono() {
+	// use most recent voice for poly sources, for mono sources all #VOICES are identical so it doesnt matter
+	applyRouteLists(m_mono_routes[0], m_most_recent_voice, 0);
+	applyRouteLists(m_mono_routes[1], m_most_recent_voice, 0);
+}
+
+void ModMatrix::applyModulationMono(bool p_audio_rate) {
+	applyRouteLists(m_mono_routes[p_audio_rate ? 1 : 0], m_most_recent_voice, 0);
+}
+
+void ModMatrix::applyModulationVoice(int p_voice) {
+	applyRouteLists(m_voice_routes[0], p_voice, p_voice);
+	applyRouteLists(m_voice_routes[1], p_voice, p_voice);
+}
+
+void ModMatrix::applyModulationVoice(int p_voice, bool p_audio_rate) {
+	applyRouteLists(m_voice_routes[p_audio_rate ? 1 : 0], p_voice, p_voice);
+}
+
+bool ModMatrix::updateRoutes() {
+	if (!m_routes_dirty) {
+		return false;
+	}
+	m_routes_dirty = false;
+
+	int old_mono_clear[MODMATRIX_ROWS * 2];
+	int old_voice_clear[MODMATRIX_ROWS * 2];
+	const int old_num_mono_clear  = m_num_mono_clear;
+	const int old_num_voice_clear = m_num_voice_clear;
+	memcpy(old_mono_clear, m_mono_clear, sizeof(int) * m_num_mono_clear);
+	memcpy(old_voice_clear, m_voice_clear, sizeof(int) * m_num_voice_clear);
+
+	compileRoutes();
+
+	// the lists are built in row order, so any change in the routed destinations shows up as a difference here
+	const bool changed = !m_routes_compiled || old_num_mono_clear != m_num_mono_clear ||
+	                     old_num_voice_clear != m_num_voice_clear ||
+	                     memcmp(old_mono_clear, m_mono_clear, sizeof(int) * m_num_mono_clear) ||
+	                     memcmp(old_voice_clear, m_voice_clear, sizeof(int) * m_num_voice_clear);
+	if (changed) {
+		// destinations which lost their route are not cleared anymore, so they have to be zero from now on
+		zeroAllDestinations();
+	}
+	m_routes_compiled = true;
+	return changed;
+}
+
+void ModMatrix::compileRoutes() {
+	for (int mode = 0; mode < MOD_SCALE_MODES; ++mode) {
+		m_mono_routes[0][mode].size  = 0;
+		m_mono_routes[1][mode].size  = 0;
+		m_voice_routes[0][mode].size = 0;
+		m_voice_routes[1][mode].size = 0;
+	}
+	m_num_mono_clear  = 0;
+	m_num_voice_clear = 0;
+
+	const float *mono_base  = reinterpret_cast<const float *>(static_cast<ModDestMono *>(m_destinations));
+	const float *voice_base = reinterpret_cast<const float *>(&(m_destinations->voice[0]));
 	for (int row = 0; row < MODMATRIX_ROWS; ++row) {
-		if (m_row[row]) {
-			m_row[row].applyModulation();
+		ModRoute routes[2];
+		const int num_routes = m_row[row].getRoutes(routes);
+		for (int index = 0; index < num_routes; ++index) {
+			const ModRoute &route = routes[index];
+			if (route.poly) {
+				ModRouteList &list      = m_voice_routes[route.audio_rate ? 1 : 0][route.scale_mode];
+				list.route[list.size++] = route;
+
+				const int offset = (int)(route.destination[0] - voice_base);
+				if (std::find(m_voice_clear, m_voice_clear + m_num_voice_clear, offset) == m_voice_clear + m_num_voice_clear) {
+					m_voice_clear[m_num_voice_clear++] = offset;
+				}
+			} else {
+				ModRouteList &list      = m_mono_routes[route.audio_rate ? 1 : 0][route.scale_mode];
+				list.route[list.size++] = route;
+
+				const int offset = (int)(route.destination[0] - mono_base);
+				if (std::find(m_mono_clear, m_mono_clear + m_num_mono_clear, offset) == m_mono_clear + m_num_mono_clear) {
+					m_mono_clear[m_num_mono_clear++] = offset;
+				}
+			}
 		}
 	}
 }
@@ -1081,6 +1116,7 @@ void ModMatrix::setSourcesAndDestinations(ModSources *p_sources, ModDestinations
 	m_destinations = p_destinations;
 	zeroAllDestinations();
 	zeroAllSources();
+	m_routes_dirty = true;
 }
 
 // ModMatrix::ModMatrix(ModSources *p_sources, ModDestinations
@@ -1092,32 +1128,39 @@ void ModMatrix::setSourcesAndDestinations(ModSources *p_sources, ModDestinations
 
 void ModMatrix::setModSource(int p_row, int p_source) {
 	m_row[p_row].setModSource(p_source);
+	m_routes_dirty = true;
 	checkWhichSourceToRender();
 }
 
 void ModMatrix::setModDestination1(int p_row, int p_destination) {
 	m_row[p_row].setModDestination1(p_destination);
+	m_routes_dirty = true;
 }
 void ModMatrix::setModDestination2(int p_row, int p_destination) {
 	m_row[p_row].setModDestination2(p_destination);
+	m_routes_dirty = true;
 	// DBG("row: " + std::to_string(p_row));
 }
 
 void ModMatrix::setModScale(int p_row, int p_scale) {
 	m_row[p_row].setModScale(p_scale);
+	m_routes_dirty = true;
 	checkWhichSourceToRender();
 }
 
 void ModMatrix::setModAmount1(int p_row, float p_mod_amount) {
 	m_row[p_row].setModAmount1(p_mod_amount);
+	m_routes_dirty = true;
 }
 void ModMatrix::setModAmount2(int p_row, float p_mod_amount) {
 	m_row[p_row].setModAmount2(p_mod_amount);
+	m_routes_dirty = true;
 	// DBG("row: " + std::to_string(p_row));
 }
 
 void ModMatrix::setScaleAmount(int p_row, float p_scale_amount) {
 	m_row[p_row].setScaleAmount(p_scale_amount);
+	m_routes_dirty = true;
 }
 
 void ModMatrix::zeroAllSources() {
@@ -1128,6 +1171,20 @@ void ModMatrix::zeroAllDestinations() {
 	memset(m_destinations, 0, sizeof(ModDestinations));
 }
 
+void ModMatrix::zeroMonoDestinations() {
+	float *mono = reinterpret_cast<float *>(static_cast<ModDestMono *>(m_destinations));
+	for (int index = 0; index < m_num_mono_clear; ++index) {
+		mono[m_mono_clear[index]] = 0.f;
+	}
+}
+
+void ModMatrix::zeroVoiceDestinations(int p_voice) {
+	float *voice = reinterpret_cast<float *>(&(m_destinations->voice[p_voice]));
+	for (int index = 0; index < m_num_voice_clear; ++index) {
+		voice[m_voice_clear[index]] = 0.f;
+	}
+}
+
 void ModMatrix::checkWhichSourceToRender() {
 	bool render_LFO[4]  = {0};
 	bool render_ADSR[2] = {0};
@@ -132,8 +132,9 @@ struct ModDestVoice {
   ModDestDistortion distortion;
 };
 
-struct ModDestinations {
-  ModDestVoice voice[VOICES];
+// all destinations which are not per voice. These are split off so the sub-block renderer
+// can store them for every sample and hand them to filter 3 and the fx later on
+struct ModDestMono {
   ModDestADSR global_adsr;
   ModDestLFO global_lfo;
   ModDestFilter filter3;
@@ -146,6 +147,71 @@ struct ModDestinations {
   ModDestMisc misc;
 };
 
+struct ModDestinations : ModDestMono {
+  ModDestVoice voice[VOICES];
+};
+
+// ramps the routed values of a destination struct linearly from their current value to a new target over one
+// control period. The destination structs consist of floats only, the routed values are given as float offsets
+// into them. Values without a route are not touched, the mod matrix keeps them at zero
+template <typename Dest> class ModDestRamp {
+public:
+  // the next target is taken over directly, e.g. when a voice starts or the routes changed
+  void jump() { m_jump = true; }
+
+  // p_offsets has to stay valid until the next call, a different set of offsets needs a jump()
+  void setTarget(const Dest &p_target, const int *p_offsets, int p_num_offsets, int p_steps) {
+    jassert(p_num_offsets <= MAX_VALUES);
+    const float *target = reinterpret_cast<const float *>(&p_target);
+    m_offsets           = p_offsets;
+    m_num_offsets       = p_num_offsets;
+    if (m_jump || p_steps <= 1) {
+      for (int i = 0; i < m_num_offsets; ++i) {
+        m_value[i] = target[m_offsets[i]];
+      }
+      m_steps_left = 0;
+      m_jump       = false;
+      return;
+    }
+    for (int i = 0; i < m_num_offsets; ++i) {
+      m_target[i]    = target[m_offsets[i]];
+      m_increment[i] = (m_target[i] - m_value[i]) / (float)p_steps;
+    }
+    m_steps_left = p_steps;
+  }
+
+  // advances the ramp by one sample and writes the routed values to p_dest
+  void next(Dest &p_dest) {
+    if (m_steps_left > 0) {
+      if (--m_steps_left == 0) {
+        // land exactly on the target
+        memcpy(m_value, m_target, sizeof(float) * m_num_offsets);
+      } else {
+        for (int i = 0; i < m_num_offsets; ++i) {
+          m_value[i] += m_increment[i];
+        }
+      }
+    }
+    float *dest = reinterpret_cast<float *>(&p_dest);
+    for (int i = 0; i < m_num_offsets; ++i) {
+      dest[m_offsets[i]] = m_value[i];
+    }
+  }
+
+private:
+  static_assert(sizeof(Dest) % sizeof(float) == 0, "destination structs may only contain floats");
+  // every row routes to at most two destinations
+  static constexpr int MAX_VALUES = MODMATRIX_ROWS * 2;
+
+  const int *m_offsets = nullptr;
+  int m_num_offsets    = 0;
+  float m_value[MAX_VALUES]     = {0};
+  float m_target[MAX_VALUES]    = {0};
+  float m_increment[MAX_VALUES] = {0};
+  int m_steps_left = 0;
+  bool m_jump      = true;
+};
+
 struct ModSourceVoice {
   float* osc[3];
   float* filter[2];
@@ -158,19 +224,22 @@ struct ModSourceVoice {
   float* arp_mod_1;
   float* arp_mod_2;
 
+  // mono sources which change every sample. Each voice points to its own copy,
+  // so voices can be rendered independently of each other
+  float* global_lfo;
+  float* global_adsr;
+  float* modwheel;
+  float* pitchwheel;
+  float* x;
+  float* y;
+
   //this was abandoned, but is here to avoid crashes:
   float* MIDI_aftertouch;
 };
 
 struct ModSources {
   ModSourceVoice voice[VOICES];
-  float* global_lfo;
-  float* global_adsr;
   float* filter3;
-  float* modwheel;
-  float* pitchwheel;
-  float* x;
-  float* y;
   float* MIDI_channel_pressure;
   float* MIDI_breath;
   float* constant;
@@ -178,6 +247,31 @@ struct ModSources {
   float* sustain_pedal;
 };
 
+#define MOD_SCALE_NONE 0
+#define MOD_SCALE_POSITIVE 1
+#define MOD_SCALE_NEGATIVE 2
+#define MOD_SCALE_MODES 3
+
+// a single source -> destination connection of the matrix. The pointer arrays are the ones of the row, indexed by
+// voice. Mono routes always write to destination[0] and read the source of the most recent voice
+struct ModRoute {
+  float *const *source;
+  float *const *scale;
+  float *const *destination;
+  float amount;
+  float amount_abs;
+  float scale_amount;
+  int scale_mode;
+  bool poly;
+  bool audio_rate;
+};
+
+// routes of one kind, they all run through the same kernel
+struct ModRouteList {
+  ModRoute route[MODMATRIX_ROWS * 2];
+  int size = 0;
+};
+
 class ModMatrixRow {
 public:
   ModMatrixRow(){}
@@ -188,7 +282,13 @@ public:
     return m_active_1 || m_active_2;
   }
 
-  void applyModulation();
+  // writes the routes of the active slots to p_routes and returns how many there are (up to 2)
+  int getRoutes(ModRoute *p_routes) const;
+
+  // true if the source or scale is an oscillator or filter output, these have to be applied every sample
+  bool isAudioRate() const {
+    return m_audio_rate;
+  }
 
   //this sets for source and scale
   void setModSource(int p_source, float** p_source_pointers, int& p_source_store);
@@ -236,6 +336,7 @@ private:
   int m_scale = 0;
   bool m_active_1 = false;//only for one of the two modulation slots
   bool m_active_2 = false;//only for one of the two modulation slots
+  bool m_audio_rate = false;
 
   float m_mod_amount_1 = 0.f;
   float m_mod_amount_2 = 0.f;
@@ -261,7 +362,16 @@ public:
 
   void setSourcesAndDestinations(ModSources *p_source, ModDestinations *p_destination);
 
-  void applyModulation();
+  // compiles the rows into route lists if they changed since the last call. Returns true if the set of routed
+  // destinations changed, all destinations are zeroed then. Call from the audio thread only
+  bool updateRoutes();
+
+  void applyModulationMono();
+  // only applies the rows with audio rate sources (p_audio_rate) or only the ones which can run at control rate
+  void applyModulationMono(bool p_audio_rate);
+  void applyModulationVoice(int p_voice);
+  // only applies the rows with audio rate sources (p_audio_rate) or only the ones which can run at control rate
+  void applyModulationVoice(int p_voice, bool p_audio_rate);
 
   void setModSource(int p_row, int p_source);
   void setModDestination1(int p_row, int p_destination);
@@ -276,16 +386,50 @@ public:
       m_row[row].setMostRecentVoice(p_voice);
     }
   }
+  int getMostRecentVoice() const {
+    return m_most_recent_voice;
+  }
   void checkWhichSourceToRender();
 
 
   void zeroAllSources();
   void zeroAllDestinations();
+  // these only zero destinations which have a route
+  void zeroMonoDestinations();
+  void zeroVoiceDestinations(int p_voice);
+
+  // the routed destinations as float offsets into ModDestMono and ModDestVoice, for the control rate ramps
+  const int *getMonoDestinationOffsets() const {
+    return m_mono_clear;
+  }
+  int getNumMonoDestinationOffsets() const {
+    return m_num_mono_clear;
+  }
+  const int *getVoiceDestinationOffsets() const {
+    return m_voice_clear;
+  }
+  int getNumVoiceDestinationOffsets() const {
+    return m_num_voice_clear;
+  }
 
   std::function<void(bool, bool, bool, bool, bool, bool)> setSourcesToRender;
 private:
+  void compileRoutes();
+
   int m_most_recent_voice = 0;
   ModMatrixRow m_row[MODMATRIX_ROWS];
   ModSources* m_sources;
   ModDestinations* m_destinations;
+
+  // the rows are changed by the parameter handlers on the audio thread, which also rebuilds the routes
+  bool m_routes_dirty = true;
+  bool m_routes_compiled = false;
+  ModRouteList m_mono_routes[2][MOD_SCALE_MODES]; // control rate, audio rate
+  ModRouteList m_voice_routes[2][MOD_SCALE_MODES]; // control rate, audio rate
+
+  // destinations which have a route as float offsets into ModDestMono and ModDestVoice
+  int m_mono_clear[MODMATRIX_ROWS * 2];
+  int m_num_mono_clear = 0;
+  int m_voice_clear[MODMATRIX_ROWS * 2];
+  int m_num_voice_clear = 0;
 };
\ No newline at end of file
@@ -15,9 +15,8 @@
 
 #include "OdinArpeggiator.h"
 #include <algorithm>
-#include <random>
-
-#define NO_NOTE std::make_tuple(-1, 0, 0.f, 0.f)
+#include <cmath>
+#include <limits>
 
 bool sortKeysDownToUp(std::pair<int, int> a, std::pair<int, int> b) {
 	return a.first < b.first;
@@ -52,56 +51,103 @@ String OdinArpeggiator::ArpPatternToString(ArpPattern p_pattern) {
 	}
 }
 
-std::tuple<int, int, float, float> OdinArpeggiator::getNoteOns(int &pio_step_active) {
+OdinArpeggiator::OdinArpeggiator() : m_random_engine(std::random_device{}()) {
+}
+
+int OdinArpeggiator::process(int p_num_samples, ArpEventBuffer &po_events) {
 	jassert(m_samplerate > 0);
+	po_events.size = 0;
 
-	if (m_oneshot_end_reached) {
-		pio_step_active = -1;
-		return NO_NOTE;
+	// the step timer only runs while there is something to play
+	if (!m_oneshot_end_reached && m_arp_sequence_size > 0) {
+		if (*m_speed_mod) {
+			//change speed by octaves:
+			m_speed_mod_factor = juce::dsp::FastMathApproximations::exp(0.693147 * (*m_speed_mod));
+		} else {
+			m_speed_mod_factor = 1.f;
+		}
 	}
-
-	//pattern is empty, nothing to do
-	if (m_arp_sequence.size() == 0) {
-		pio_step_active = -1;
-		return NO_NOTE;
+	const double increment = m_one_over_samplerate * m_speed_mod_factor;
+
+	float gate_modded = m_gate;
+	if (*m_gate_mod > 0) {
+		gate_modded += *m_gate_mod;
+	} else if (*m_gate_mod < 0) {
+		gate_modded += *m_gate_mod * m_gate;
+		gate_modded = gate_modded < 0.f ? 0.f : gate_modded;
 	}
+	const double gate_time = m_arp_time * gate_modded;
+
+	// ticks are samples, an event at tick n is played at sample n - 1
+	int ticks = 0;
+	while (ticks < p_num_samples) {
+		// one tick can add a note on, an early note off and the note offs of all playing notes
+		if (po_events.size + ARP_PLAYING_NOTES_MAX + 2 > ARP_EVENTS_MAX) {
+			break;
+		}
 
-	//increment time
-	if (*m_speed_mod) {
-		//change speed by octaves:
-		m_speed_mod_factor = juce::dsp::FastMathApproximations::exp(0.693147 * (*m_speed_mod));
-		m_time_since_last_note += m_one_over_samplerate * m_speed_mod_factor;
-	} else {
-		m_time_since_last_note += m_one_over_samplerate;
-		m_speed_mod_factor = 1.f;
+		const int remaining = p_num_samples - ticks;
+		const bool running  = !m_oneshot_end_reached && m_arp_sequence_size > 0;
+
+		// jump straight to the next tick which has something to do
+		int next = remaining + 1;
+		if (running) {
+			next = m_start_pattern ? 1 : ticksUntil(m_time_since_last_note, m_arp_time, increment, next);
+		}
+		for (int note = 0; note < m_num_playing_notes; ++note) {
+			next = jmin(next, ticksUntil(m_playing_notes_timer[note], gate_time, increment, next));
+		}
+		if (next > remaining) {
+			next = remaining;
+		}
+
+		const double elapsed = next * increment;
+		if (running) {
+			m_time_since_last_note += elapsed;
+		}
+		for (int note = 0; note < m_num_playing_notes; ++note) {
+			m_playing_notes_timer[note] += elapsed;
+		}
+		ticks += next;
+
+		//start new pattern or new note?
+		if (running && (m_start_pattern || m_time_since_last_note > m_arp_time)) {
+			startStep(ticks - 1, increment, po_events);
+		}
+
+		//end notes which are over
+		int kept = 0;
+		for (int note = 0; note < m_num_playing_notes; ++note) {
+			if (m_playing_notes_timer[note] > gate_time) {
+				addEvent(po_events, ticks - 1, m_playing_notes[note], 0, 0.f, 0.f);
+			} else {
+				m_playing_notes[kept]       = m_playing_notes[note];
+				m_playing_notes_timer[kept] = m_playing_notes_timer[note];
+				++kept;
+			}
+		}
+		m_num_playing_notes = kept;
 	}
 
-	//start new pattern?
+	m_step_active = (m_oneshot_end_reached || m_arp_sequence_size == 0) ? -1 : m_current_sequence_index;
+	return ticks;
+}
+
+int OdinArpeggiator::getStepActive() const {
+	return m_step_active;
+}
+
+void OdinArpeggiator::startStep(int p_sample, double p_increment, ArpEventBuffer &po_events) {
 	if (m_start_pattern) {
 		m_start_pattern          = false;
 		m_current_arp_index      = 0;
 		m_current_sequence_index = 0;
-		pio_step_active          = 0;
-		m_time_since_last_note   = 0.f;
-		if (m_sequence_steps_on[m_current_sequence_index]) {
-			m_playing_notes.push_back(std::make_pair(
-			    m_arp_sequence[m_current_arp_index].first + m_transpose_steps[m_current_sequence_index], 0.f));
-			return transposeSemi(m_arp_sequence[m_current_arp_index],
-			                     m_transpose_steps[m_current_sequence_index],
-			                     m_mod_1_steps[m_current_sequence_index],
-			                     m_mod_2_steps[m_current_sequence_index]);
-		} else {
-			return NO_NOTE;
-		}
-	}
-
-	//start new note?
-	if (m_time_since_last_note > m_arp_time) {
+	} else {
 		++m_current_arp_index;
-		if (m_current_arp_index >= m_arp_sequence.size()) {
+		if (m_current_arp_index >= m_arp_sequence_size) {
 			//updown skips a beat when wrapping
 			if ((m_pattern == ArpPattern::UpAndDown || m_pattern == ArpPattern::DownAndUp) &&
-			    m_arp_sequence.size() > 1) {
+			    m_arp_sequence_size > 1) {
 				m_current_arp_index = 1;
 			} else if (m_pattern == ArpPattern::Random) {
 				//arp needs to be redone every pattern
@@ -115,50 +161,62 @@ std::tuple<int, int, float, float> OdinArpeggiator::getNoteOns(int &pio_step_act
 		if (m_current_sequence_index >= m_max_sequence_steps) {
 			m_current_sequence_index = 0;
 			if (m_oneshot) {
-				m_current_sequence_index = 0;
-				pio_step_active          = -1;
-				m_oneshot_end_reached    = true;
-				return NO_NOTE;
+				m_oneshot_end_reached = true;
+				return;
 			}
 		}
-		pio_step_active        = m_current_sequence_index;
-		m_time_since_last_note = 0.f;
-
-		if (m_sequence_steps_on[m_current_sequence_index]) {
-			m_playing_notes.push_back(std::make_pair(
-			    m_arp_sequence[m_current_arp_index].first + m_transpose_steps[m_current_sequence_index], 0.f));
-			return transposeSemi(m_arp_sequence[m_current_arp_index],
-			                     m_transpose_steps[m_current_sequence_index],
-			                     m_mod_1_steps[m_current_sequence_index],
-			                     m_mod_2_steps[m_current_sequence_index]);
+	}
+	m_time_since_last_note = 0.;
+
+	if (m_sequence_steps_on[m_current_sequence_index]) {
+		const int note = m_arp_sequence[m_current_arp_index].first + m_transpose_steps[m_current_sequence_index];
+		if (m_num_playing_notes == ARP_PLAYING_NOTES_MAX) {
+			// no room left, end the oldest note now
+			addEvent(po_events, p_sample, m_playing_notes[0], 0, 0.f, 0.f);
+			for (int playing = 0; playing < m_num_playing_notes - 1; ++playing) {
+				m_playing_notes[playing]       = m_playing_notes[playing + 1];
+				m_playing_notes_timer[playing] = m_playing_notes_timer[playing + 1];
+			}
+			--m_num_playing_notes;
 		}
+		addEvent(po_events,
+		         p_sample,
+		         note,
+		         m_arp_sequence[m_current_arp_index].second,
+		         m_mod_1_steps[m_current_sequence_index],
+		         m_mod_2_steps[m_current_sequence_index]);
+		// the note timer already runs on the sample the note starts
+		m_playing_notes[m_num_playing_notes]       = note;
+		m_playing_notes_timer[m_num_playing_notes] = p_increment;
+		++m_num_playing_notes;
 	}
+}
 
-	//well then do nothing I guess
-	pio_step_active = m_current_sequence_index;
-	return NO_NOTE;
-}
-
-std::vector<int> OdinArpeggiator::getNoteOffs() {
-	std::vector<int> ret;
-	for (int note = 0; note < m_playing_notes.size(); ++note) {
-		m_playing_notes[note].second += m_one_over_samplerate * m_speed_mod_factor;
-		float gate_modded = m_gate;
-		if(*m_gate_mod > 0){
-			gate_modded += *m_gate_mod;
-		} else if(*m_gate_mod < 0){
-			gate_modded += *m_gate_mod * m_gate;
-			gate_modded = gate_modded < 0.f ? 0.f : gate_modded;
-		}
+void OdinArpeggiator::addEvent(
+    ArpEventBuffer &po_events, int p_sample, int p_note, int p_velocity, float p_mod_1, float p_mod_2) {
+	jassert(po_events.size < ARP_EVENTS_MAX);
+	ArpEvent &event = po_events.event[po_events.size++];
+	event.sample    = p_sample;
+	event.note      = p_note;
+	event.velocity  = p_velocity;
+	event.mod_1     = p_mod_1;
+	event.mod_2     = p_mod_2;
+}
 
-		if (m_playing_notes[note].second > m_arp_time * gate_modded) {
-			ret.push_back(m_playing_notes[note].first);
-			m_playing_notes.erase(m_playing_notes.begin() + note);
-			//go one back since we deleted one
-			--note;
-		}
+int OdinArpeggiator::ticksUntil(double p_time, double p_threshold, double p_increment, int p_max_ticks) {
+	const double ticks = std::floor((p_threshold - p_time) / p_increment) + 1.;
+	// this also catches an infinite or NaN step time
+	if (!(ticks < (double)p_max_ticks)) {
+		return p_max_ticks;
+	}
+	if (ticks < 1.) {
+		return 1;
+	}
+	// the caller advances by the product below, so don't trust the division to be exact
+	int ret = (int)ticks;
+	while (ret > 1 && p_time + (ret - 1) * p_increment > p_threshold) {
+		--ret;
 	}
-
 	return ret;
 }
 
@@ -175,15 +233,14 @@ void OdinArpeggiator::reset() {
 void OdinArpeggiator::midiNoteOn(int p_midi_note, int p_midi_velocity) {
 	if (m_sustain_active) {
 		//in sustain avoid adding double notes:
-		for (auto note : m_active_keys_and_velocities) {
-			if (note.first == p_midi_note) {
+		for (int key = 0; key < m_num_active_keys; ++key) {
+			if (m_active_keys_and_velocities[key].first == p_midi_note) {
 				//this note is already on, remove it from kill list if necessary
-				for (int kill = 0; kill < m_sustain_kill_list.size(); ++kill) {
+				for (int kill = 0; kill < m_sustain_kill_list_size; ++kill) {
 					if (m_sustain_kill_list[kill] == p_midi_note) {
-						m_sustain_kill_list.erase(m_sustain_kill_list.begin() + kill);
+						m_sustain_kill_list[kill] = m_sustain_kill_list[--m_sustain_kill_list_size];
 						//DBG("ERASED FROM KILLIST: " + std::to_string(p_midi_note));
 						//printKillList();
-						--kill;
 						break;
 					}
 				}
@@ -191,9 +248,13 @@ void OdinArpeggiator::midiNoteOn(int p_midi_note, int p_midi_velocity) {
 			}
 		}
 	}
-	m_active_keys_and_velocities.push_back(std::make_pair(p_midi_note, p_midi_velocity));
+	if (m_num_active_keys == ARP_KEYS_MAX) {
+		// too many keys held down, the key is ignored
+		return;
+	}
+	m_active_keys_and_velocities[m_num_active_keys++] = std::make_pair(p_midi_note, p_midi_velocity);
 	//DBG("NOTEON: " + std::to_string(p_midi_note));
-	if (m_active_keys_and_velocities.size() == 1) {
+	if (m_num_active_keys == 1) {
 		m_start_pattern = true;
 	}
 	generateSequence();
@@ -201,14 +262,24 @@ void OdinArpeggiator::midiNoteOn(int p_midi_note, int p_midi_velocity) {
 }
 
 void OdinArpeggiator::midiNoteOff(int p_midi_note) {
-	for (int key = 0; key < m_active_keys_and_velocities.size(); ++key) {
+	for (int key = 0; key < m_num_active_keys; ++key) {
 		if (m_active_keys_and_velocities[key].first == p_midi_note) {
 			if (m_sustain_active) {
-				m_sustain_kill_list.push_back(p_midi_note);
+				// every key is on the kill list once at most, so it can't hold more entries than there are keys
+				bool on_kill_list = false;
+				for (int kill = 0; kill < m_sustain_kill_list_size; ++kill) {
+					on_kill_list |= m_sustain_kill_list[kill] == p_midi_note;
+				}
+				if (!on_kill_list) {
+					m_sustain_kill_list[m_sustain_kill_list_size++] = p_midi_note;
+				}
 				//DBG("ADDED TO KILL LIST: " + std::to_string(p_midi_note));
 				//printKillList();
 			} else {
-				m_active_keys_and_velocities.erase(m_active_keys_and_velocities.begin() + key);
+				for (int shift = key; shift < m_num_active_keys - 1; ++shift) {
+					m_active_keys_and_velocities[shift] = m_active_keys_and_velocities[shift + 1];
+				}
+				--m_num_active_keys;
 				//in case we have the same note two times in a row (they are sorted):
 				--key;
 				generateSequence();
@@ -221,19 +292,17 @@ void OdinArpeggiator::midiNoteOff(int p_midi_note) {
 
 void OdinArpeggiator::endPlayingNotes() {
 	//set timer to max, so it ends on next sample
-	std::vector<std::pair<int, float>> ret;
-	for (auto note : m_playing_notes) {
-		ret.push_back(std::make_pair(note.first, std::numeric_limits<float>::max()));
+	for (int note = 0; note < m_num_playing_notes; ++note) {
+		m_playing_notes_timer[note] = std::numeric_limits<double>::max();
 	}
-	m_playing_notes = ret;
 }
 
 void OdinArpeggiator::allMidiNotesOff() {
 	endPlayingNotes();
-	m_active_keys_and_velocities.clear();
-	m_sustain_kill_list.clear();
+	m_num_active_keys        = 0;
+	m_sustain_kill_list_size = 0;
 	//printKillList();
-	m_arp_sequence.clear();
+	m_arp_sequence_size = 0;
 	m_current_arp_index = -1;
 }
 
@@ -246,11 +315,11 @@ void OdinArpeggiator::setSustainActive(bool p_sustain_active) {
 
 void OdinArpeggiator::executeKillList() {
 	// we are now in sustain off, so midinoteoff kills notes for sure
-	for (auto key : m_sustain_kill_list) {
-		//DBG("EXECUTE: " + std::to_string(key));
-		midiNoteOff(key);
+	for (int kill = 0; kill < m_sustain_kill_list_size; ++kill) {
+		//DBG("EXECUTE: " + std::to_string(m_sustain_kill_list[kill]));
+		midiNoteOff(m_sustain_kill_list[kill]);
 	}
-	m_sustain_kill_list.clear();
+	m_sustain_kill_list_size = 0;
 	//printKillList();
 	generateSequence();
 }
@@ -263,50 +332,43 @@ std::pair<int, int> OdinArpeggiator::transposeOct(std::pair<int, int> p_note, in
 	return std::make_pair(p_note.first + 12 * p_octave, p_note.second);
 }
 
-std::tuple<int, int, float, float> OdinArpeggiator::transposeSemi(std::pair<int, int> p_note,
-                                                                  int p_semitones,
-                                                                  float p_mod_1,
-                                                                  float p_mod_2) {
-	return std::make_tuple(p_note.first + p_semitones, p_note.second, p_mod_1, p_mod_2);
-}
-
 void OdinArpeggiator::generateSequence() {
 
-	m_arp_sequence.clear();
+	m_arp_sequence_size = 0;
 	switch (m_pattern) {
 	case ArpPattern::Up:
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysDownToUp);
+		std::sort(m_active_keys_and_velocities, m_active_keys_and_velocities + m_num_active_keys, sortKeysDownToUp);
 		for (int octave = 0; octave < m_octaves; ++octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				m_arp_sequence.push_back(transposeOct(note, octave));
+			for (int key = 0; key < m_num_active_keys; ++key) {
+				addToSequence(transposeOct(m_active_keys_and_velocities[key], octave));
 			}
 		}
 		break;
 	case ArpPattern::Down:
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysUpToDown);
+		std::sort(m_active_keys_and_velocities, m_active_keys_and_velocities + m_num_active_keys, sortKeysUpToDown);
 		for (int octave = m_octaves - 1; octave >= 0; --octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				m_arp_sequence.push_back(transposeOct(note, octave));
+			for (int key = 0; key < m_num_active_keys; ++key) {
+				addToSequence(transposeOct(m_active_keys_and_velocities[key], octave));
 			}
 		}
 		break;
 	case ArpPattern::UpAndDown:
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysDownToUp);
+		std::sort(m_active_keys_and_velocities, m_active_keys_and_velocities + m_num_active_keys, sortKeysDownToUp);
 		for (int octave = 0; octave < m_octaves; ++octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				m_arp_sequence.push_back(transposeOct(note, octave));
+			for (int key = 0; key < m_num_active_keys; ++key) {
+				addToSequence(transposeOct(m_active_keys_and_velocities[key], octave));
 			}
 		}
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysUpToDown);
+		std::sort(m_active_keys_and_velocities, m_active_keys_and_velocities + m_num_active_keys, sortKeysUpToDown);
 		{
 			bool first_note = true;
 			for (int octave = m_octaves - 1; octave >= 0; --octave) {
-				for (auto note : m_active_keys_and_velocities) {
+				for (int key = 0; key < m_num_active_keys; ++key) {
 					//omit first note when going down again
 					if (first_note) {
 						first_note = false;
 					} else {
-						m_arp_sequence.push_back(transposeOct(note, octave));
+						addToSequence(transposeOct(m_active_keys_and_velocities[key], octave));
 					}
 				}
 			}
@@ -314,22 +376,22 @@ void OdinArpeggiator::generateSequence() {
 		break;
 
 	case ArpPattern::DownAndUp:
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysUpToDown);
+		std::sort(m_active_keys_and_velocities, m_active_keys_and_velocities + m_num_active_keys, sortKeysUpToDown);
 		for (int octave = m_octaves - 1; octave >= 0; --octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				m_arp_sequence.push_back(transposeOct(note, octave));
+			for (int key = 0; key < m_num_active_keys; ++key) {
+				addToSequence(transposeOct(m_active_keys_and_velocities[key], octave));
 			}
 		}
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysDownToUp);
+		std::sort(m_active_keys_and_velocities, m_active_keys_and_velocities + m_num_active_keys, sortKeysDownToUp);
 		{
 			bool first_note = true;
 			for (int octave = 0; octave < m_octaves; ++octave) {
-				for (auto note : m_active_keys_and_velocities) {
+				for (int key = 0; key < m_num_active_keys; ++key) {
 					//omit first note when going down again
 					if (first_note) {
 						first_note = false;
 					} else {
-						m_arp_sequence.push_back(transposeOct(note, octave));
+						addToSequence(transposeOct(m_active_keys_and_velocities[key], octave));
 					}
 				}
 			}
@@ -337,54 +399,55 @@ void OdinArpeggiator::generateSequence() {
 		break;
 	case ArpPattern::Random:
 		//do up pattern and shuffle it
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysDownToUp);
+		std::sort(m_active_keys_and_velocities, m_active_keys_and_velocities + m_num_active_keys, sortKeysDownToUp);
 		for (int octave = 0; octave < m_octaves; ++octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				m_arp_sequence.push_back(transposeOct(note, octave));
+			for (int key = 0; key < m_num_active_keys; ++key) {
+				addToSequence(transposeOct(m_active_keys_and_velocities[key], octave));
 			}
 		}
 		{
-			std::default_random_engine RNG(std::random_device{}());
-			std::shuffle(std::begin(m_arp_sequence), std::end(m_arp_sequence), RNG);
+			std::shuffle(m_arp_sequence, m_arp_sequence + m_arp_sequence_size, m_random_engine);
 		}
 		break;
 	case ArpPattern::CrawlUp: {
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysDownToUp);
-		std::vector<std::pair<int, int>> temp_arp_index;
+		std::sort(m_active_keys_and_velocities, m_active_keys_and_velocities + m_num_active_keys, sortKeysDownToUp);
+		std::pair<int, int> temp_arp_index[ARP_KEYS_MAX * ARP_OCTAVES_MAX];
+		int temp_arp_size = 0;
 		for (int octave = 0; octave < m_octaves; ++octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				temp_arp_index.push_back(transposeOct(note, octave));
+			for (int key = 0; key < m_num_active_keys; ++key) {
+				temp_arp_index[temp_arp_size++] = transposeOct(m_active_keys_and_velocities[key], octave);
 			}
 		}
 		for (int crawl_index = 0;
-		     crawl_index < (int)temp_arp_index.size() - (int)m_active_keys_and_velocities.size() + 1;
+		     crawl_index < temp_arp_size - m_num_active_keys + 1;
 		     ++crawl_index) {
-			for (int sub_index = 0; sub_index < m_active_keys_and_velocities.size(); ++sub_index) {
-				m_arp_sequence.push_back(temp_arp_index[crawl_index + sub_index]);
+			for (int sub_index = 0; sub_index < m_num_active_keys; ++sub_index) {
+				addToSequence(temp_arp_index[crawl_index + sub_index]);
 			}
 		}
 		//ovoid empty pattern:
-		if (m_arp_sequence.size() == 0 && m_active_keys_and_velocities.size() >= 1) {
-			m_arp_sequence.push_back(m_active_keys_and_velocities[0]);
+		if (m_arp_sequence_size == 0 && m_num_active_keys >= 1) {
+			addToSequence(m_active_keys_and_velocities[0]);
 		}
 	} break;
 	case ArpPattern::CrawlDown: {
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysUpToDown);
-		std::vector<std::pair<int, int>> temp_arp_index;
+		std::sort(m_active_keys_and_velocities, m_active_keys_and_velocities + m_num_active_keys, sortKeysUpToDown);
+		std::pair<int, int> temp_arp_index[ARP_KEYS_MAX * ARP_OCTAVES_MAX];
+		int temp_arp_size = 0;
 		for (int octave = m_octaves - 1; octave >= 0; --octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				temp_arp_index.push_back(transposeOct(note, octave));
+			for (int key = 0; key < m_num_active_keys; ++key) {
+				temp_arp_index[temp_arp_size++] = transposeOct(m_active_keys_and_velocities[key], octave);
 			}
 		}
 		for (int crawl_index = 0;
-		     crawl_index < (int)temp_arp_index.size() - (int)m_active_keys_and_velocities.size() + 1;
+		     crawl_index < temp_arp_size - m_num_active_keys + 1;
 		     ++crawl_index) {
-			for (int sub_index = 0; sub_index < m_active_keys_and_velocities.size(); ++sub_index) {
-				m_arp_sequence.push_back(temp_arp_index[crawl_index + sub_index]);
+			for (int sub_index = 0; sub_index < m_num_active_keys; ++sub_index) {
+				addToSequence(temp_arp_index[crawl_index + sub_index]);
 			}
 		}
-		if (m_arp_sequence.size() == 0 && m_active_keys_and_velocities.size() >= 1) {
-			m_arp_sequence.push_back(m_active_keys_and_velocities[0]);
+		if (m_arp_sequence_size == 0 && m_num_active_keys >= 1) {
+			addToSequence(m_active_keys_and_velocities[0]);
 		}
 	} break;
 	default:
@@ -392,17 +455,23 @@ void OdinArpeggiator::generateSequence() {
 	}
 
 	//kill arp if all notes off:
-	if (m_arp_sequence.size() == 0) {
+	if (m_arp_sequence_size == 0) {
 		endPlayingNotes();
 	}
 	//printSequence();
 }
 
+void OdinArpeggiator::addToSequence(std::pair<int, int> p_note) {
+	if (m_arp_sequence_size < ARP_SEQUENCE_MAX) {
+		m_arp_sequence[m_arp_sequence_size++] = p_note;
+	}
+}
+
 void OdinArpeggiator::printSequence() {
 #ifdef ODIN_DEBUG
 	DBG("Current sequence:");
-	for (auto note : m_arp_sequence) {
-		DBG("Key: " + String(note.first) + ", Vel: " + String(note.second));
+	for (int index = 0; index < m_arp_sequence_size; ++index) {
+		DBG("Key: " + String(m_arp_sequence[index].first) + ", Vel: " + String(m_arp_sequence[index].second));
 	}
 	DBG("----");
 #endif
@@ -430,7 +499,7 @@ void OdinArpeggiator::setSynctimeDenominator(float p_value) {
 }
 
 void OdinArpeggiator::setOctaves(int p_new_value) {
-	m_octaves = p_new_value;
+	m_octaves = jlimit(1, ARP_OCTAVES_MAX, p_new_value);
 	generateSequence();
 }
 
@@ -465,9 +534,8 @@ void OdinArpeggiator::setStepMod2(int p_step, float p_mod) {
 
 void OdinArpeggiator::printKillList() {
 	DBG("KList:");
-	for (auto key : m_sustain_kill_list) {
-		(void)key;//<- hide compile warning
-		DBG(key);
+	for (int kill = 0; kill < m_sustain_kill_list_size; ++kill) {
+		DBG(m_sustain_kill_list[kill]);
 	}
 	DBG("------");
 }
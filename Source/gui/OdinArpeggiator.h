@@ -17,9 +17,32 @@
 
 #include "../JuceLibraryCode/JuceHeader.h"
 #include "../GlobalIncludes.h"
+#include <random>
 #include <utility>
 
 #define NUMBER_SEQUENCE_STEPS 16
+// keys held down at once, further keys are ignored
+#define ARP_KEYS_MAX 32
+#define ARP_OCTAVES_MAX 4
+// the crawl patterns are the longest: (keys * (octaves - 1) + 1) runs of all keys
+#define ARP_SEQUENCE_MAX (ARP_KEYS_MAX * (ARP_KEYS_MAX * (ARP_OCTAVES_MAX - 1) + 1))
+// notes waiting for their note off, the oldest one is ended early if there are more
+#define ARP_PLAYING_NOTES_MAX 32
+#define ARP_EVENTS_MAX 128
+
+// a note on or note off of the arpeggiator, sample is the offset into the window passed to process()
+struct ArpEvent {
+	int sample;
+	int note;
+	int velocity; // 0 for note offs
+	float mod_1;
+	float mod_2;
+};
+
+struct ArpEventBuffer {
+	ArpEvent event[ARP_EVENTS_MAX];
+	int size = 0;
+};
 
 class OdinArpeggiator {
 public:
@@ -38,8 +61,16 @@ public:
 
 	static String ArpPatternToString(ArpPattern p_pattern);
 
-	std::tuple<int, int, float, float> getNoteOns(int &pio_step_active);
-	std::vector<int> getNoteOffs();
+	OdinArpeggiator();
+
+	// advances the arpeggiator by up to p_num_samples and writes the notes it plays meanwhile to po_events.
+	// The step times are calculated from the tempo, so there is no work per sample. The speed and gate
+	// modulation are read once per call, so callers keep p_num_samples short. Returns the number of samples
+	// processed, which is less than p_num_samples only if po_events ran full. Must not be called across changes to
+	// the held keys
+	int process(int p_num_samples, ArpEventBuffer &po_events);
+	// the sequence step playing at the end of the last process() call, -1 if none
+	int getStepActive() const;
 
 	void setSampleRate(double p_samplerate);
 	void reset();
@@ -76,14 +107,17 @@ private:
 
 	void executeKillList();
 	void generateSequence();
+	void addToSequence(std::pair<int, int> p_note);
 	void calcArpTime();
 
+	// moves on to the next step and writes its note to po_events
+	void startStep(int p_sample, double p_increment, ArpEventBuffer &po_events);
+	static void addEvent(ArpEventBuffer &po_events, int p_sample, int p_note, int p_velocity, float p_mod_1, float p_mod_2);
+	// the first tick at which p_time + ticks * p_increment exceeds p_threshold, p_max_ticks if that is later
+	static int ticksUntil(double p_time, double p_threshold, double p_increment, int p_max_ticks);
+
 	void printSequence();
 	std::pair<int, int> transposeOct(std::pair<int, int> note, int p_ocatve);
-	std::tuple<int, int, float, float> transposeSemi(std::pair<int, int> p_note,
-	                                                 int p_semitones,
-	                                                 float p_mod_1,
-	                                                 float p_mod_2);
 	float m_synctime_numerator   = 2.f;
 	float m_synctime_denominator = 16.f;
 	float m_synctime_ratio       = 2.f / 16.f;
@@ -94,8 +128,10 @@ private:
 	float m_mod_1_steps[NUMBER_SEQUENCE_STEPS] = {0};
 	float m_mod_2_steps[NUMBER_SEQUENCE_STEPS] = {0};
 
-	std::vector<std::pair<int, int>> m_active_keys_and_velocities = {};
-	std::vector<int> m_sustain_kill_list                          = {};
+	std::pair<int, int> m_active_keys_and_velocities[ARP_KEYS_MAX];
+	int m_num_active_keys = 0;
+	int m_sustain_kill_list[ARP_KEYS_MAX];
+	int m_sustain_kill_list_size = 0;
 
 	double m_samplerate          = -1;
 	double m_one_over_samplerate = -1;
@@ -112,12 +148,18 @@ private:
 	bool m_oneshot           = false;
 
 	//temp parametes
-	std::vector<std::pair<int, int>> m_arp_sequence;    //note, velocity
-	std::vector<std::pair<int, float>> m_playing_notes; //note, timer
+	std::pair<int, int> m_arp_sequence[ARP_SEQUENCE_MAX]; //note, velocity
+	int m_arp_sequence_size = 0;
+	int m_playing_notes[ARP_PLAYING_NOTES_MAX];
+	double m_playing_notes_timer[ARP_PLAYING_NOTES_MAX];
+	int m_num_playing_notes       = 0;
 	int m_current_arp_index       = -1;
 	int m_current_sequence_index  = -1;
 	double m_time_since_last_note = 0.;
 	bool m_oneshot_end_reached    = false;
+	int m_step_active             = -1;
+
+	std::default_random_engine m_random_engine;
 
 	//modulation parameters
 	float *m_speed_mod;
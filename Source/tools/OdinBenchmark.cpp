@@ -0,0 +1,730 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+// odin2-bench: times the hot dsp modules in isolation and the whole processBlock() with factory patches, built with
+// -DODIN2_BUILD_BENCHMARK=ON. Run it with --help for the usage.
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "../PluginProcessor.h"
+
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#define BENCH_DEFAULT_SECONDS 2.
+#define BENCH_DEFAULT_REPEATS 5
+#define BENCH_DEFAULT_TOLERANCE_PERCENT 10.
+#define BENCH_WARMUP_SECONDS 0.25
+#define BENCH_OSC_FREQ 110.f
+
+static void printUsage() {
+	std::printf(
+	    "usage: odin2-bench [options]\n"
+	    "\n"
+	    "  --filter <text>             only runs the benchmarks whose name contains <text>\n"
+	    "  --list                      prints the benchmark names and exits\n"
+	    "  --rates <hz,hz,...>         sample rates (default 44100,48000,96000)\n"
+	    "  --blocks <n,n,...>          block sizes (default 32,128,512)\n"
+	    "  --seconds <s>               audio rendered per measurement (default 2)\n"
+	    "  --repeats <n>               measurements per benchmark, the fastest one counts (default 5)\n"
+	    "  --soundbanks <dir>          folder with the factory presets (default assets/Soundbanks)\n"
+	    "  --multi-core <0|1>          multi-core voice rendering for processBlock (default 0)\n"
+	    "  --save-baseline <file>      writes the results as a baseline\n"
+	    "  --baseline <file>           compares the results against a baseline, fails on regressions\n"
+	    "  --tolerance <percent>       slowdown against the baseline which counts as regression (default 10)\n"
+	    "\n"
+	    "Results are reported in ns per sample (for processBlock per stereo sample frame). Use the same machine and\n"
+	    "build type for the baseline and the comparison, otherwise the numbers say nothing.\n");
+}
+
+// stands in for the master oscillator of hard sync. It wraps every few samples without costing anything itself,
+// so only the synced oscillator is timed
+class SyncPulse : public Oscillator {
+public:
+	float doOscillate() override {
+		return 0.f;
+	}
+	void randomizePhase() override {
+	}
+	inline void tick(int p_period) {
+		m_reset_flag = ++m_counter >= p_period;
+		if (m_reset_flag) {
+			m_counter = 0;
+		}
+	}
+
+private:
+	int m_counter = 0;
+};
+
+/**
+ * A single benchmark. prepare() sets everything up for a sample rate and block size, process() renders one block.
+ * The modules are created in prepare(), so every run starts from the same state.
+ */
+class BenchmarkCase {
+public:
+	BenchmarkCase(const String &p_name) : m_name(p_name) {
+	}
+	virtual ~BenchmarkCase() = default;
+
+	virtual void prepare(double p_sample_rate, int p_block_size) = 0;
+	// p_input holds noise for the filters and fx, the oscillators ignore it
+	virtual void process(const float *p_input, float *po_left, float *po_right, int p_num_samples) = 0;
+
+	const String &getName() const {
+		return m_name;
+	}
+
+protected:
+	String m_name;
+	// all modulation inputs point here
+	float m_zero = 0.f;
+};
+
+static void wireOscillator(Oscillator &p_osc, float *p_zero) {
+	p_osc.setPitchModExpPointer(p_zero);
+	p_osc.setPitchModLinPointer(p_zero);
+	p_osc.setPitchBendPointer(p_zero);
+	p_osc.setGlidePointer(p_zero);
+}
+
+static void wireFilter(OdinFilterBase &p_filter, float *p_zero) {
+	p_filter.setFreqModPointer(p_zero);
+	p_filter.setResModPointer(p_zero);
+	p_filter.setVelModPointer(p_zero);
+	p_filter.setKbdModPointer(p_zero);
+	p_filter.setSaturationModPointer(p_zero);
+	p_filter.setEnvModPointer(p_zero);
+}
+
+template <typename Osc> class OscillatorCase : public BenchmarkCase {
+public:
+	OscillatorCase(const String &p_name,
+	               WavetableContainer &p_WT_container,
+	               std::function<void(Osc &, float *)> p_configure,
+	               bool p_sync = false) :
+	    BenchmarkCase(p_name),
+	    m_WT_container(p_WT_container), m_configure(p_configure), m_sync(p_sync) {
+	}
+
+	void prepare(double p_sample_rate, int) override {
+		m_osc = std::make_unique<Osc>();
+		wireOscillator(*m_osc, &m_zero);
+		m_osc->setWavetableContainer(&m_WT_container);
+		m_osc->loadWavetables();
+		m_osc->setSampleRate((float)p_sample_rate);
+		m_configure(*m_osc, &m_zero);
+		setupSync();
+		m_osc->reset();
+		m_osc->setBaseFrequency(BENCH_OSC_FREQ);
+		m_osc->setGlideTargetFrequency(BENCH_OSC_FREQ);
+		m_sync_period = (int)(p_sample_rate / (BENCH_OSC_FREQ * 0.7f));
+	}
+
+	void process(const float *, float *po_left, float *, int p_num_samples) override {
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			m_osc->update();
+			po_left[sample] = processSample();
+		}
+	}
+
+private:
+	void setupSync();
+	float processSample();
+
+	WavetableContainer &m_WT_container;
+	std::function<void(Osc &, float *)> m_configure;
+	bool m_sync;
+	int m_sync_period = 1;
+	SyncPulse m_sync_pulse;
+	std::unique_ptr<Osc> m_osc;
+};
+
+// only the wavetable oscillators know about sync
+template <typename Osc> void OscillatorCase<Osc>::setupSync() {
+}
+template <> void OscillatorCase<WavetableOsc1D>::setupSync() {
+	m_osc->setSyncOscillator(&m_sync_pulse);
+	m_osc->setSyncEnabled(m_sync);
+}
+template <typename Osc> float OscillatorCase<Osc>::processSample() {
+	return m_osc->doOscillate();
+}
+template <> float OscillatorCase<WavetableOsc1D>::processSample() {
+	if (m_sync) {
+		m_sync_pulse.tick(m_sync_period);
+		return m_osc->doOscillateWithSync();
+	}
+	return m_osc->doOscillate();
+}
+
+template <typename Filter> class FilterCase : public BenchmarkCase {
+public:
+	FilterCase(const String &p_name, std::function<void(Filter &, float *)> p_configure) :
+	    BenchmarkCase(p_name), m_configure(p_configure) {
+	}
+
+	void prepare(double p_sample_rate, int) override {
+		m_filter = std::make_unique<Filter>();
+		wireFilter(*m_filter, &m_zero);
+		m_filter->setSampleRate(p_sample_rate);
+		m_filter->m_freq_base = 800.;
+		m_filter->setResControl(0.5);
+		m_configure(*m_filter, &m_zero);
+		m_filter->reset();
+	}
+
+	void process(const float *p_input, float *po_left, float *, int p_num_samples) override {
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			m_filter->update();
+			po_left[sample] = (float)m_filter->doFilter(p_input[sample]);
+		}
+	}
+
+private:
+	std::function<void(Filter &, float *)> m_configure;
+	std::unique_ptr<Filter> m_filter;
+};
+
+// the comb filter is no OdinFilterBase and updates itself
+class CombFilterCase : public BenchmarkCase {
+public:
+	CombFilterCase() : BenchmarkCase("CombFilter") {
+	}
+
+	void prepare(double p_sample_rate, int) override {
+		m_filter = std::make_unique<CombFilter>();
+		m_filter->setFreqModPointer(&m_zero);
+		m_filter->setResModPointer(&m_zero);
+		m_filter->setEnvModPointer(&m_zero);
+		m_filter->setVelModPointer(&m_zero);
+		m_filter->setKbdModPointer(&m_zero);
+		m_filter->setSampleRate((float)p_sample_rate);
+		m_filter->setCombFreq(220.f);
+		m_filter->setResonance(0.8f);
+		m_filter->setPositive(true);
+		m_filter->reset();
+	}
+
+	void process(const float *p_input, float *po_left, float *, int p_num_samples) override {
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			po_left[sample] = m_filter->doFilter(p_input[sample]);
+		}
+	}
+
+private:
+	std::unique_ptr<CombFilter> m_filter;
+};
+
+class DistortionCase : public BenchmarkCase {
+public:
+	DistortionCase() : BenchmarkCase("OversamplingDistortion") {
+	}
+
+	void prepare(double, int) override {
+		m_distortion = std::make_unique<OversamplingDistortion>();
+		m_distortion->setThresholdModPointer(&m_zero);
+		m_distortion->setDryWetModPointer(&m_zero);
+		m_distortion->setAlgorithm(OversamplingDistortion::Fold);
+		m_distortion->setThreshold(0.3f);
+		m_distortion->setDryWet(1.f);
+		m_distortion->reset();
+	}
+
+	void process(const float *p_input, float *po_left, float *, int p_num_samples) override {
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			po_left[sample] = (float)m_distortion->doDistortion(p_input[sample]);
+		}
+	}
+
+private:
+	std::unique_ptr<OversamplingDistortion> m_distortion;
+};
+
+class DelayCase : public BenchmarkCase {
+public:
+	DelayCase() : BenchmarkCase("Delay") {
+	}
+
+	void prepare(double p_sample_rate, int) override {
+		m_delay = std::make_unique<Delay>();
+		m_delay->setTimeModPointer(&m_zero);
+		m_delay->setFeedbackModPointer(&m_zero);
+		m_delay->setHPFreqModPointer(&m_zero);
+		m_delay->setDryModPointer(&m_zero);
+		m_delay->setWetModPointer(&m_zero);
+		m_delay->setSampleRate((float)p_sample_rate);
+		m_delay->setDelayTime(0.3f);
+		m_delay->setFeedback(0.6f);
+		m_delay->setHPFreq(80.f);
+		m_delay->setDucking(0.3f);
+		m_delay->setDry(1.f);
+		m_delay->setWet(0.5f);
+		m_delay->setPingPong(true);
+		m_delay->reset();
+	}
+
+	void process(const float *p_input, float *po_left, float *po_right, int p_num_samples) override {
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			po_left[sample]  = m_delay->doDelayLeft(p_input[sample]);
+			po_right[sample] = m_delay->doDelayRight(p_input[sample]);
+		}
+	}
+
+private:
+	std::unique_ptr<Delay> m_delay;
+};
+
+class PhaserCase : public BenchmarkCase {
+public:
+	PhaserCase() : BenchmarkCase("Phaser") {
+	}
+
+	void prepare(double p_sample_rate, int) override {
+		m_phaser = std::make_unique<Phaser>();
+		m_phaser->setRateModPointer(&m_zero);
+		m_phaser->setAmountModPointer(&m_zero);
+		m_phaser->setDryWetModPointer(&m_zero);
+		m_phaser->setFreqModPointer(&m_zero);
+		m_phaser->setFeedbackModPointer(&m_zero);
+		m_phaser->setSampleRate((float)p_sample_rate);
+		m_phaser->setRadiusBase(1.25f);
+		m_phaser->setLFOFreq(0.5f);
+		m_phaser->setLFOAmplitude(0.5f);
+		m_phaser->setBaseFreq(1000.f);
+		m_phaser->setFeedback(0.5f);
+		m_phaser->setDryWet(0.5f);
+		m_phaser->reset();
+	}
+
+	void process(const float *p_input, float *po_left, float *po_right, int p_num_samples) override {
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			po_left[sample]  = m_phaser->doPhaserLeft(p_input[sample]);
+			po_right[sample] = m_phaser->doPhaserRight(p_input[sample]);
+		}
+	}
+
+private:
+	std::unique_ptr<Phaser> m_phaser;
+};
+
+class ReverbCase : public BenchmarkCase {
+public:
+	ReverbCase(bool p_half_rate) :
+	    BenchmarkCase(p_half_rate ? "ZitaReverb half rate" : "ZitaReverb"), m_half_rate(p_half_rate) {
+	}
+
+	void prepare(double p_sample_rate, int) override {
+		m_reverb = std::make_unique<ZitaReverb>();
+		m_reverb->setSampleRate((float)p_sample_rate);
+		m_reverb->setHalfRate(m_half_rate);
+		m_reverb->set_delay(0.04f);
+		m_reverb->set_rtmid(2.f);
+		m_reverb->set_fdamp(6000.f);
+		m_reverb->set_opmix(0.5f);
+		m_reverb->prepare();
+		m_reverb->reset();
+	}
+
+	void process(const float *p_input, float *po_left, float *po_right, int p_num_samples) override {
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			float stereo_signal[2] = {p_input[sample], p_input[sample]};
+			m_reverb->process(stereo_signal);
+			po_left[sample]  = stereo_signal[0];
+			po_right[sample] = stereo_signal[1];
+		}
+	}
+
+private:
+	bool m_half_rate;
+	std::unique_ptr<ZitaReverb> m_reverb;
+};
+
+// the whole plugin with a patch holding a four note chord
+class ProcessBlockCase : public BenchmarkCase {
+public:
+	ProcessBlockCase(const String &p_name, const File &p_patch, bool p_multi_core) :
+	    BenchmarkCase("processBlock " + p_name), m_patch(p_patch), m_multi_core(p_multi_core) {
+	}
+
+	void prepare(double p_sample_rate, int p_block_size) override {
+		m_processor.reset();
+		m_processor = std::make_unique<OdinAudioProcessor>();
+		m_processor->setRateAndBufferSizeDetails(p_sample_rate, p_block_size);
+		m_processor->prepareToPlay(p_sample_rate, p_block_size);
+		m_processor->setMultiCoreVoiceRendering(m_multi_core);
+		if (m_patch == File()) {
+			MemoryInputStream init_stream(BinaryData::init_patch_odin, BinaryData::init_patch_odinSize, false);
+			m_processor->readPatch(ValueTree::readFromStream(init_stream));
+		} else {
+			FileInputStream stream(m_patch);
+			m_processor->readPatch(ValueTree::readFromStream(stream));
+		}
+		m_buffer.setSize(2, p_block_size);
+		m_chord_sent = false;
+	}
+
+	void process(const float *, float *po_left, float *po_right, int p_num_samples) override {
+		m_midi.clear();
+		if (!m_chord_sent) {
+			for (int note : {48, 55, 60, 64}) {
+				m_midi.addEvent(MidiMessage::noteOn(1, note, (uint8)100), 0);
+			}
+			m_chord_sent = true;
+		}
+		m_buffer.clear();
+		m_processor->processBlock(m_buffer, m_midi);
+		po_left[0]  = m_buffer.getSample(0, p_num_samples - 1);
+		po_right[0] = m_buffer.getSample(1, p_num_samples - 1);
+	}
+
+	bool isValid() const {
+		return m_patch == File() || m_patch.existsAsFile();
+	}
+
+private:
+	File m_patch;
+	bool m_multi_core;
+	std::unique_ptr<OdinAudioProcessor> m_processor;
+	AudioBuffer<float> m_buffer;
+	MidiBuffer m_midi;
+	bool m_chord_sent = false;
+};
+
+//==============================================================================
+
+struct BenchSettings {
+	Array<double> sample_rates = {44100., 48000., 96000.};
+	Array<int> block_sizes     = {32, 128, 512};
+	double seconds             = BENCH_DEFAULT_SECONDS;
+	int repeats                = BENCH_DEFAULT_REPEATS;
+	double tolerance_percent   = BENCH_DEFAULT_TOLERANCE_PERCENT;
+	bool multi_core            = false;
+};
+
+// factory presets which cover the oscillator, filter and fx types, relative to the soundbank folder
+static const char *const s_benchmark_patches[] = {"Factory Presets/Bass/Analog Bass [tx].odin",
+                                                  "Factory Presets/Bass/Bass Simple PM [RS].odin",
+                                                  "Factory Presets/Leads/Filter LFO Lead.odin",
+                                                  "Factory Presets/Leads/Glide Comb Lead.odin",
+                                                  "Factory Presets/Keys/FM Piano.odin",
+                                                  "Factory Presets/Pads/Choir Aahs 1 [RS].odin",
+                                                  "Factory Presets/Atmospheres/Antarctica [RS].odin"};
+
+static std::vector<std::unique_ptr<BenchmarkCase>>
+createCases(WavetableContainer &p_WT_container, const File &p_soundbanks, const BenchSettings &p_settings) {
+	std::vector<std::unique_ptr<BenchmarkCase>> cases;
+
+	cases.push_back(std::make_unique<OscillatorCase<WavetableOsc1D>>(
+	    "WavetableOsc1D::doOscillate", p_WT_container, [](WavetableOsc1D &p_osc, float *) {
+		    p_osc.selectWavetable(1);
+	    }));
+	cases.push_back(std::make_unique<OscillatorCase<WavetableOsc1D>>(
+	    "WavetableOsc1D::doOscillate cubic", p_WT_container, [](WavetableOsc1D &p_osc, float *) {
+		    p_osc.selectWavetable(1);
+		    p_osc.setCubicInterpolation(true);
+	    }));
+	cases.push_back(std::make_unique<OscillatorCase<WavetableOsc1D>>(
+	    "WavetableOsc1D::doOscillateWithSync",
+	    p_WT_container,
+	    [](WavetableOsc1D &p_osc, float *) { p_osc.selectWavetable(1); },
+	    true));
+	cases.push_back(std::make_unique<OscillatorCase<MultiOscillator>>(
+	    "MultiOscillator", p_WT_container, [](MultiOscillator &p_osc, float *p_zero) {
+		    p_osc.setPosModPointer(p_zero);
+		    p_osc.setDetuneModPointer(p_zero);
+		    p_osc.setSpreadModPointer(p_zero);
+		    p_osc.setDetune(0.3f);
+		    p_osc.setWavetableMultiSpread(0.2f);
+		    p_osc.setPosition(0.4f);
+	    }));
+	cases.push_back(std::make_unique<OscillatorCase<FMOscillator>>(
+	    "FMOscillator", p_WT_container, [](FMOscillator &p_osc, float *p_zero) {
+		    p_osc.setFMModPointer(p_zero);
+		    p_osc.setCarrierRatioModPointer(p_zero);
+		    p_osc.setModulatorRatioModPointer(p_zero);
+		    p_osc.setRatio(1, 3);
+		    p_osc.setFMAmount(0.4f);
+	    }));
+	cases.push_back(std::make_unique<OscillatorCase<PMOscillator>>(
+	    "PMOscillator", p_WT_container, [](PMOscillator &p_osc, float *p_zero) {
+		    p_osc.setPMModPointer(p_zero);
+		    p_osc.setCarrierRatioModPointer(p_zero);
+		    p_osc.setModulatorRatioModPointer(p_zero);
+		    p_osc.setRatio(1, 2);
+		    p_osc.setPMAmount(0.4f);
+	    }));
+	cases.push_back(std::make_unique<OscillatorCase<VectorOscillator>>(
+	    "VectorOscillator", p_WT_container, [](VectorOscillator &p_osc, float *p_zero) {
+		    p_osc.setXModPointer(p_zero);
+		    p_osc.setYModPointer(p_zero);
+		    for (int point = 0; point < VECTOR_EDGES; ++point) {
+			    p_osc.selectWavetable(point + 1, point);
+		    }
+		    p_osc.setXYPad(0.3f, 0.6f);
+	    }));
+
+	cases.push_back(std::make_unique<FilterCase<LadderFilter>>("LadderFilter", [](LadderFilter &p_filter, float *) {
+		p_filter.m_overdrive = 0.5f;
+	}));
+	cases.push_back(std::make_unique<FilterCase<SEMFilter12>>("SEMFilter12", [](SEMFilter12 &p_filter, float *p_zero) {
+		p_filter.setTransitionModPointer(p_zero);
+	}));
+	cases.push_back(std::make_unique<FilterCase<Korg35Filter>>("Korg35Filter", [](Korg35Filter &p_filter, float *) {
+		p_filter.setFilterType(true);
+		p_filter.m_overdrive = 0.5f;
+	}));
+	cases.push_back(std::make_unique<FilterCase<DiodeFilter>>("DiodeFilter", [](DiodeFilter &p_filter, float *) {
+		p_filter.m_overdrive = 0.5f;
+	}));
+	cases.push_back(
+	    std::make_unique<FilterCase<FormantFilter>>("FormantFilter", [](FormantFilter &p_filter, float *p_zero) {
+		    p_filter.setTransitionModPointer(p_zero);
+		    p_filter.setVowelLeft(0);
+		    p_filter.setVowelRight(3);
+		    p_filter.setTransition(0.5f);
+	    }));
+	cases.push_back(std::make_unique<CombFilterCase>());
+
+	cases.push_back(std::make_unique<DistortionCase>());
+	cases.push_back(std::make_unique<DelayCase>());
+	cases.push_back(std::make_unique<PhaserCase>());
+	cases.push_back(std::make_unique<ReverbCase>(false));
+	cases.push_back(std::make_unique<ReverbCase>(true));
+
+	cases.push_back(std::make_unique<ProcessBlockCase>("init patch", File(), p_settings.multi_core));
+	for (const char *patch : s_benchmark_patches) {
+		const File file = p_soundbanks.getChildFile(patch);
+		auto patch_case = std::make_unique<ProcessBlockCase>(file.getFileNameWithoutExtension(), file, p_settings.multi_core);
+		if (patch_case->isValid()) {
+			cases.push_back(std::move(patch_case));
+		} else {
+			std::fprintf(stderr, "skipping %s, not found\n", file.getFullPathName().toRawUTF8());
+		}
+	}
+	return cases;
+}
+
+//==============================================================================
+
+// identifies one measurement in the baseline file
+static String resultKey(const String &p_case, double p_sample_rate, int p_block_size) {
+	return p_case + "\t" + String((int)p_sample_rate) + "\t" + String(p_block_size);
+}
+
+// the baseline is a text file with one line per measurement: name, sample rate, block size and ns per sample,
+// separated by tabs. Lines starting with # are comments
+static bool loadBaseline(const File &p_file, std::map<String, double> &po_baseline) {
+	if (!p_file.existsAsFile()) {
+		std::fprintf(stderr, "can't read baseline %s\n", p_file.getFullPathName().toRawUTF8());
+		return false;
+	}
+	StringArray lines;
+	p_file.readLines(lines);
+	for (const String &line : lines) {
+		if (line.startsWith("#") || line.trim().isEmpty()) {
+			continue;
+		}
+		const StringArray fields = StringArray::fromTokens(line, "\t", "");
+		if (fields.size() != 4) {
+			std::fprintf(stderr, "ignoring malformed baseline line: %s\n", line.toRawUTF8());
+			continue;
+		}
+		po_baseline[fields[0] + "\t" + fields[1] + "\t" + fields[2]] = fields[3].getDoubleValue();
+	}
+	return true;
+}
+
+// the same input for every benchmark
+static void fillNoise(std::vector<float> &po_noise) {
+	Random random(1);
+	for (float &sample : po_noise) {
+		sample = random.nextFloat() - 0.5f;
+	}
+}
+
+// renders p_num_blocks blocks and returns the time it took in seconds
+static double runBlocks(BenchmarkCase &p_case,
+                        const float *p_input,
+                        float *po_left,
+                        float *po_right,
+                        int p_block_size,
+                        int64 p_num_blocks) {
+	const int64 start_ticks = Time::getHighResolutionTicks();
+	for (int64 block = 0; block < p_num_blocks; ++block) {
+		p_case.process(p_input, po_left, po_right, p_block_size);
+	}
+	return Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start_ticks);
+}
+
+// the outputs end up here, so the compiler can't throw the work away
+static volatile float s_sink = 0.f;
+
+// returns the ns per sample of the fastest repeat
+static double measure(BenchmarkCase &p_case, double p_sample_rate, int p_block_size, const BenchSettings &p_settings) {
+	p_case.prepare(p_sample_rate, p_block_size);
+
+	std::vector<float> input((size_t)p_block_size), left((size_t)p_block_size), right((size_t)p_block_size);
+	fillNoise(input);
+
+	const int64 warmup_blocks  = jmax((int64)1, (int64)(BENCH_WARMUP_SECONDS * p_sample_rate / p_block_size));
+	const int64 measure_blocks = jmax((int64)1, (int64)(p_settings.seconds * p_sample_rate / p_block_size));
+	runBlocks(p_case, input.data(), left.data(), right.data(), p_block_size, warmup_blocks);
+
+	double best_seconds = -1.;
+	for (int repeat = 0; repeat < p_settings.repeats; ++repeat) {
+		const double seconds = runBlocks(p_case, input.data(), left.data(), right.data(), p_block_size, measure_blocks);
+		best_seconds         = best_seconds < 0. ? seconds : jmin(best_seconds, seconds);
+	}
+	s_sink = s_sink + left[0] + right[0];
+
+	return best_seconds * 1e9 / (double)(measure_blocks * p_block_size);
+}
+
+static Array<double> parseList(const String &p_list) {
+	Array<double> values;
+	for (const String &token : StringArray::fromTokens(p_list, ",", "")) {
+		const double value = token.getDoubleValue();
+		if (value > 0.) {
+			values.add(value);
+		}
+	}
+	return values;
+}
+
+//==============================================================================
+
+int main(int argc, char *argv[]) {
+	ScopedJuceInitialiser_GUI juce_initialiser;
+
+	BenchSettings settings;
+	String filter;
+	bool list_only = false;
+	File soundbanks = File::getCurrentWorkingDirectory().getChildFile("assets/Soundbanks");
+	File baseline_file, save_baseline_file;
+
+	for (int arg = 1; arg < argc; ++arg) {
+		const String name    = argv[arg];
+		const bool has_value = arg + 1 < argc;
+		const String value   = has_value ? String(argv[arg + 1]) : String();
+		if (name == "--list") {
+			list_only = true;
+			continue;
+		}
+		if (name == "--help" || !has_value) {
+			printUsage();
+			return name == "--help" ? 0 : 1;
+		}
+		++arg;
+		if (name == "--filter") {
+			filter = value;
+		} else if (name == "--rates") {
+			settings.sample_rates = parseList(value);
+		} else if (name == "--blocks") {
+			settings.block_sizes.clear();
+			for (double block_size : parseList(value)) {
+				settings.block_sizes.add((int)block_size);
+			}
+		} else if (name == "--seconds") {
+			settings.seconds = value.getDoubleValue();
+		} else if (name == "--repeats") {
+			settings.repeats = value.getIntValue();
+		} else if (name == "--soundbanks") {
+			soundbanks = File::getCurrentWorkingDirectory().getChildFile(value);
+		} else if (name == "--multi-core") {
+			settings.multi_core = value.getIntValue() > 0;
+		} else if (name == "--baseline") {
+			baseline_file = File::getCurrentWorkingDirectory().getChildFile(value);
+		} else if (name == "--save-baseline") {
+			save_baseline_file = File::getCurrentWorkingDirectory().getChildFile(value);
+		} else if (name == "--tolerance") {
+			settings.tolerance_percent = value.getDoubleValue();
+		} else {
+			printUsage();
+			return 1;
+		}
+	}
+
+	if (settings.sample_rates.isEmpty() || settings.block_sizes.isEmpty() || settings.seconds <= 0. ||
+	    settings.repeats < 1 || settings.tolerance_percent < 0.) {
+		printUsage();
+		return 1;
+	}
+
+	std::map<String, double> baseline;
+	if (baseline_file != File() && !loadBaseline(baseline_file, baseline)) {
+		return 1;
+	}
+
+	WavetableContainer WT_container;
+
+	auto cases = createCases(WT_container, soundbanks, settings);
+	if (list_only) {
+		for (auto &benchmark : cases) {
+			std::printf("%s\n", benchmark->getName().toRawUTF8());
+		}
+		return 0;
+	}
+
+	String baseline_out = "# odin2-bench baseline: name, sample rate, block size, ns per sample\n";
+	int regressions     = 0;
+
+	std::printf("%-45s %8s %6s %12s %12s %9s\n", "benchmark", "rate", "block", "ns/sample", "baseline", "change");
+	for (auto &benchmark : cases) {
+		if (filter.isNotEmpty() && !benchmark->getName().containsIgnoreCase(filter)) {
+			continue;
+		}
+		for (double sample_rate : settings.sample_rates) {
+			for (int block_size : settings.block_sizes) {
+				const double ns_per_sample = measure(*benchmark, sample_rate, block_size, settings);
+				const String key           = resultKey(benchmark->getName(), sample_rate, block_size);
+				baseline_out << key << "\t" << String(ns_per_sample, 3) << "\n";
+
+				std::printf("%-45s %8d %6d %12.3f",
+				            benchmark->getName().toRawUTF8(),
+				            (int)sample_rate,
+				            block_size,
+				            ns_per_sample);
+				const auto reference = baseline.find(key);
+				if (reference != baseline.end() && reference->second > 0.) {
+					const double change  = 100. * (ns_per_sample / reference->second - 1.);
+					const bool regressed = change > settings.tolerance_percent;
+					regressions += regressed ? 1 : 0;
+					std::printf(
+					    " %12.3f %+8.1f%%%s", reference->second, change, regressed ? "  REGRESSION" : "");
+				}
+				std::printf("\n");
+				std::fflush(stdout);
+			}
+		}
+	}
+
+	if (save_baseline_file != File()) {
+		if (!save_baseline_file.replaceWithText(baseline_out)) {
+			std::fprintf(stderr, "can't write baseline %s\n", save_baseline_file.getFullPathName().toRawUTF8());
+			return 1;
+		}
+		std::printf("baseline written to %s\n", save_baseline_file.getFullPathName().toRawUTF8());
+	}
+	if (regressions) {
+		std::printf("FAILED: %d measurements are more than %.1f%% slower than the baseline\n",
+		            regressions,
+		            settings.tolerance_percent);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,745 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+// odin2-render: renders a patch and a midi file to a wav file without any gui or audio device, built with
+// -DODIN2_BUILD_RENDER_TOOL=ON. Run it without arguments for the usage.
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "../PluginProcessor.h"
+#include "../RealtimeChecker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#define RENDER_DEFAULT_SAMPLE_RATE 48000.
+#define RENDER_DEFAULT_BLOCK_SIZE 512
+#define RENDER_DEFAULT_TAIL_SECONDS 2.
+#define RENDER_DEFAULT_BIT_DEPTH 24
+
+static void printUsage() {
+	std::printf(
+	    "usage: odin2-render --patch <file.odin> --midi <file.mid> --out <file.wav> [options]\n"
+	    "       odin2-render --rt-check [--patch <file.odin>]... [options]\n"
+	    "       odin2-render --golden-save <dir> | --golden-check <dir> [--patch <file.odin>]... [options]\n"
+	    "\n"
+	    "  --rate <hz>           sample rate (default 48000)\n"
+	    "  --block <samples>     host block size (default 512)\n"
+	    "  --tail <seconds>      time rendered after the last midi event (default 2)\n"
+	    "  --bits <16|24|32>     wav bit depth (default 24)\n"
+	    "  --bpm <bpm>           tempo reported to the patch, default is the first tempo of the midi file or 120\n"
+	    "  --polyphony <voices>  overrides the polyphony from the config file\n"
+	    "  --control-rate <n>    overrides the mod matrix control rate from the config file\n"
+	    "  --multi-core <0|1>    overrides the multi-core voice rendering from the config file\n"
+	    "  --quality <eco|high>  render like live playback (default) or like an offline bounce of the host, which\n"
+	    "                        takes the control rate and the voice oversampling from the quality profile\n"
+	    "\n"
+	    "--rt-check loads every patch given (or the init patch), plays note storms and sweeps all parameters\n"
+	    "through it and fails if anything allocated, locked or opened a file on the audio thread. This needs a\n"
+	    "build with -DODIN2_ENABLE_RT_CHECK=ON.\n"
+	    "\n"
+	    "--golden-save renders a set of factory presets (or the patches given) with a fixed note sequence to\n"
+	    "<dir>, --golden-check renders them again and fails if they differ from the stored renders by more than:\n"
+	    "  --level-tolerance <db>     level difference of any 100 ms window (default 1)\n"
+	    "  --spectral-tolerance <db>  difference of any third octave band of the average spectrum (default 1.5)\n"
+	    "  --soundbanks <dir>         where the factory presets are (default assets/Soundbanks)\n"
+	    "Unless given, golden renders use the default polyphony and control rate and a single core.\n");
+}
+
+// reports a steady tempo and the render position to the patch
+class RenderPlayHead : public AudioPlayHead {
+public:
+	RenderPlayHead(double p_sample_rate, double p_bpm) : m_sample_rate(p_sample_rate), m_bpm(p_bpm) {
+	}
+
+	void setPosition(int64 p_sample) {
+		m_sample = p_sample;
+	}
+
+#if JUCE_VERSION >= 0x070000
+	Optional<PositionInfo> getPosition() const override {
+		PositionInfo info;
+		info.setBpm(m_bpm);
+		info.setTimeInSamples(m_sample);
+		info.setTimeInSeconds(m_sample / m_sample_rate);
+		info.setPpqPosition(m_sample / m_sample_rate * m_bpm / 60.);
+		info.setIsPlaying(true);
+		return info;
+	}
+#else
+	bool getCurrentPosition(CurrentPositionInfo &po_info) override {
+		po_info.resetToDefault();
+		po_info.bpm           = m_bpm;
+		po_info.timeInSamples = m_sample;
+		po_info.timeInSeconds = m_sample / m_sample_rate;
+		po_info.ppqPosition   = po_info.timeInSeconds * m_bpm / 60.;
+		po_info.isPlaying     = true;
+		return true;
+	}
+#endif
+
+private:
+	double m_sample_rate;
+	double m_bpm;
+	int64 m_sample = 0;
+};
+
+struct RenderSettings {
+	double sample_rate  = RENDER_DEFAULT_SAMPLE_RATE;
+	int block_size      = RENDER_DEFAULT_BLOCK_SIZE;
+	double tail_seconds = RENDER_DEFAULT_TAIL_SECONDS;
+	int bit_depth       = RENDER_DEFAULT_BIT_DEPTH;
+	double bpm          = -1.;
+	int polyphony       = -1;
+	int control_rate    = -1;
+	int multi_core      = -1;
+	bool offline        = false;
+};
+
+static std::unique_ptr<OdinAudioProcessor> createProcessor(const RenderSettings &p_settings) {
+	auto processor = std::make_unique<OdinAudioProcessor>();
+	processor->setRateAndBufferSizeDetails(p_settings.sample_rate, p_settings.block_size);
+	// picks the render quality profile in prepareToPlay
+	processor->setNonRealtime(p_settings.offline);
+	processor->prepareToPlay(p_settings.sample_rate, p_settings.block_size);
+	// after prepareToPlay, which applies the config file
+	if (p_settings.polyphony > 0) {
+		processor->setPolyphony(p_settings.polyphony);
+	}
+	if (p_settings.control_rate > 0) {
+		processor->setControlRate(p_settings.control_rate);
+	}
+	if (p_settings.multi_core >= 0) {
+		processor->setMultiCoreVoiceRendering(p_settings.multi_core > 0);
+	}
+	return processor;
+}
+
+static bool loadPatch(OdinAudioProcessor &p_processor, const File &p_file) {
+	FileInputStream stream(p_file);
+	if (!stream.openedOk()) {
+		std::fprintf(stderr, "can't open patch %s\n", p_file.getFullPathName().toRawUTF8());
+		return false;
+	}
+	const ValueTree patch = ValueTree::readFromStream(stream);
+	if (!patch.isValid()) {
+		std::fprintf(stderr, "%s is not an Odin 2 patch\n", p_file.getFullPathName().toRawUTF8());
+		return false;
+	}
+	p_processor.readPatch(patch);
+	return true;
+}
+
+static void loadInitPatch(OdinAudioProcessor &p_processor) {
+	MemoryInputStream init_stream(BinaryData::init_patch_odin, BinaryData::init_patch_odinSize, false);
+	p_processor.readPatch(ValueTree::readFromStream(init_stream));
+}
+
+// all tracks of the midi file in one sequence, with time stamps in seconds
+static bool loadMidiFile(const File &p_file, MidiMessageSequence &po_sequence, double &po_bpm) {
+	FileInputStream stream(p_file);
+	MidiFile midi_file;
+	if (!stream.openedOk() || !midi_file.readFrom(stream)) {
+		std::fprintf(stderr, "can't read midi file %s\n", p_file.getFullPathName().toRawUTF8());
+		return false;
+	}
+	midi_file.convertTimestampTicksToSeconds();
+
+	MidiMessageSequence tempo_events;
+	midi_file.findAllTempoEvents(tempo_events);
+	if (tempo_events.getNumEvents() > 0) {
+		po_bpm = 60. / tempo_events.getEventPointer(0)->message.getTempoSecondsPerQuarterNote();
+	}
+
+	for (int track = 0; track < midi_file.getNumTracks(); ++track) {
+		po_sequence.addSequence(*midi_file.getTrack(track), 0.);
+	}
+	po_sequence.updateMatchedPairs();
+	return true;
+}
+
+// length of a render of p_sequence including the tail, in samples
+static int64 getRenderLength(const MidiMessageSequence &p_sequence, const RenderSettings &p_settings) {
+	return (int64)std::ceil((p_sequence.getEndTime() + p_settings.tail_seconds) * p_settings.sample_rate);
+}
+
+// plays p_sequence (time stamps in seconds) through the processor and hands every block to p_consume. Returns the
+// time spent in processBlock() in high resolution ticks
+static int64 renderSequence(OdinAudioProcessor &p_processor,
+                            RenderPlayHead &p_play_head,
+                            const MidiMessageSequence &p_sequence,
+                            const RenderSettings &p_settings,
+                            std::function<void(const AudioBuffer<float> &)> p_consume) {
+	const int64 num_samples = getRenderLength(p_sequence, p_settings);
+
+	AudioBuffer<float> buffer(2, p_settings.block_size);
+	MidiBuffer midi_buffer;
+	int next_event      = 0;
+	int64 process_ticks = 0;
+	for (int64 block_start = 0; block_start < num_samples; block_start += p_settings.block_size) {
+		const int block_size = (int)jmin((int64)p_settings.block_size, num_samples - block_start);
+
+		midi_buffer.clear();
+		while (next_event < p_sequence.getNumEvents()) {
+			const MidiMessage &message = p_sequence.getEventPointer(next_event)->message;
+			const int64 sample         = (int64)std::llround(message.getTimeStamp() * p_settings.sample_rate);
+			if (sample >= block_start + block_size) {
+				break;
+			}
+			if (!message.isMetaEvent()) {
+				midi_buffer.addEvent(message, (int)jmax((int64)0, sample - block_start));
+			}
+			++next_event;
+		}
+
+		buffer.setSize(2, block_size, false, false, true);
+		buffer.clear();
+		p_play_head.setPosition(block_start);
+
+		const int64 start_ticks = Time::getHighResolutionTicks();
+		p_processor.processBlock(buffer, midi_buffer);
+		process_ticks += Time::getHighResolutionTicks() - start_ticks;
+
+		p_consume(buffer);
+	}
+	return process_ticks;
+}
+
+static int render(const File &p_patch, const File &p_midi, const File &p_out, RenderSettings p_settings) {
+	MidiMessageSequence sequence;
+	double midi_bpm = 120.;
+	if (!loadMidiFile(p_midi, sequence, midi_bpm)) {
+		return 1;
+	}
+	const double bpm = p_settings.bpm > 0 ? p_settings.bpm : midi_bpm;
+
+	auto processor = createProcessor(p_settings);
+	if (!loadPatch(*processor, p_patch)) {
+		return 1;
+	}
+	RenderPlayHead play_head(p_settings.sample_rate, bpm);
+	processor->setPlayHead(&play_head);
+
+	p_out.deleteFile();
+	std::unique_ptr<FileOutputStream> out_stream = p_out.createOutputStream();
+	if (!out_stream) {
+		std::fprintf(stderr, "can't write %s\n", p_out.getFullPathName().toRawUTF8());
+		return 1;
+	}
+	WavAudioFormat wav_format;
+	std::unique_ptr<AudioFormatWriter> writer(
+	    wav_format.createWriterFor(out_stream.get(), p_settings.sample_rate, 2, p_settings.bit_depth, {}, 0));
+	if (!writer) {
+		std::fprintf(stderr, "can't write wav files with %d bits\n", p_settings.bit_depth);
+		return 1;
+	}
+	// the writer owns the stream now
+	out_stream.release();
+
+	const int64 num_samples   = getRenderLength(sequence, p_settings);
+	const int64 process_ticks =
+	    renderSequence(*processor, play_head, sequence, p_settings, [&](const AudioBuffer<float> &p_block) {
+		    writer->writeFromAudioSampleBuffer(p_block, 0, p_block.getNumSamples());
+	    });
+	writer.reset();
+	processor->releaseResources();
+
+	const double audio_seconds   = num_samples / p_settings.sample_rate;
+	const double process_seconds = Time::highResolutionTicksToSeconds(process_ticks);
+	std::printf("rendered %.2f s of audio at %.0f Hz in blocks of %d\n",
+	            audio_seconds,
+	            p_settings.sample_rate,
+	            p_settings.block_size);
+	std::printf("processing took %.3f s, real-time factor %.1fx (%.2f%% of one core)\n",
+	            process_seconds,
+	            process_seconds > 0. ? audio_seconds / process_seconds : 0.,
+	            100. * process_seconds / audio_seconds);
+	return 0;
+}
+
+//==============================================================================
+//================================ RT CHECK ====================================
+//==============================================================================
+
+#define RT_CHECK_BLOCKS_PER_STAGE 200
+
+// runs RT_CHECK_BLOCKS_PER_STAGE blocks through the processor and returns the number of violations. p_prepare_block
+// is called before every block on this thread, like the message thread would, and adds the midi for it
+static int runStage(const char *p_name,
+                    OdinAudioProcessor &p_processor,
+                    const RenderSettings &p_settings,
+                    std::function<void(int, MidiBuffer &)> p_prepare_block) {
+	RealtimeChecker::resetViolations();
+	AudioBuffer<float> buffer(2, p_settings.block_size);
+	MidiBuffer midi_buffer;
+	for (int block = 0; block < RT_CHECK_BLOCKS_PER_STAGE; ++block) {
+		midi_buffer.clear();
+		p_prepare_block(block, midi_buffer);
+		buffer.clear();
+		p_processor.processBlock(buffer, midi_buffer);
+	}
+	const int violations = RealtimeChecker::getNumViolations();
+	std::printf("  %-20s %s\n", p_name, violations ? (String(violations) + " violations").toRawUTF8() : "ok");
+	return violations;
+}
+
+static int checkPatch(OdinAudioProcessor &p_processor, const RenderSettings &p_settings) {
+	Random random(1);
+	int violations = 0;
+
+	violations += runStage("idle", p_processor, p_settings, [](int, MidiBuffer &) {});
+
+	// every note at once, random velocities and sustain pedal
+	violations += runStage("note storm", p_processor, p_settings, [&](int p_block, MidiBuffer &po_midi) {
+		for (int event = 0; event < 64; ++event) {
+			const int sample = random.nextInt(p_settings.block_size);
+			const int note   = random.nextInt(128);
+			if (random.nextBool()) {
+				po_midi.addEvent(MidiMessage::noteOn(1, note, (uint8)(1 + random.nextInt(127))), sample);
+			} else {
+				po_midi.addEvent(MidiMessage::noteOff(1, note), sample);
+			}
+		}
+		po_midi.addEvent(MidiMessage::controllerEvent(1, 64, (p_block / 10) % 2 ? 127 : 0), 0);
+		po_midi.addEvent(MidiMessage::pitchWheel(1, random.nextInt(16384)), 0);
+		po_midi.addEvent(MidiMessage::controllerEvent(1, 1, random.nextInt(128)), 0);
+		if (p_block == RT_CHECK_BLOCKS_PER_STAGE - 1) {
+			po_midi.addEvent(MidiMessage::allNotesOff(1), p_settings.block_size - 1);
+		}
+	});
+
+	// every parameter moves between blocks, like host automation, while a chord plays
+	auto &parameters = p_processor.getParameters();
+	violations += runStage("automation sweep", p_processor, p_settings, [&](int p_block, MidiBuffer &po_midi) {
+		if (p_block == 0) {
+			for (int note = 48; note < 60; note += 3) {
+				po_midi.addEvent(MidiMessage::noteOn(1, note, (uint8)100), 0);
+			}
+		}
+		const float phase = (float)p_block / (float)RT_CHECK_BLOCKS_PER_STAGE;
+		for (int index = 0; index < parameters.size(); ++index) {
+			// spread the parameters over the sweep, so they don't all jump at once
+			const float value = std::fmod(phase + (float)index / (float)parameters.size(), 1.f);
+			parameters[index]->setValueNotifyingHost(value);
+		}
+	});
+
+	p_processor.allNotesOff();
+	return violations;
+}
+
+static int rtCheck(const Array<File> &p_patches, const RenderSettings &p_settings) {
+#ifndef ODIN_RT_CHECK
+	std::fprintf(stderr, "--rt-check needs a build with -DODIN2_ENABLE_RT_CHECK=ON\n");
+	return 1;
+#else
+	auto processor = createProcessor(p_settings);
+	RenderPlayHead play_head(p_settings.sample_rate, p_settings.bpm > 0 ? p_settings.bpm : 120.);
+	processor->setPlayHead(&play_head);
+
+	int violations = 0;
+	if (p_patches.isEmpty()) {
+		std::printf("init patch\n");
+		loadInitPatch(*processor);
+		violations += checkPatch(*processor, p_settings);
+	}
+	for (const File &patch : p_patches) {
+		std::printf("%s\n", patch.getFileName().toRawUTF8());
+		if (!loadPatch(*processor, patch)) {
+			return 1;
+		}
+		violations += checkPatch(*processor, p_settings);
+	}
+	processor->releaseResources();
+
+	if (violations) {
+		std::printf("FAILED: %d real-time violations\n", violations);
+		return 1;
+	}
+	std::printf("passed\n");
+	return 0;
+#endif
+}
+
+//==============================================================================
+//================================= GOLDEN =====================================
+//==============================================================================
+
+#define GOLDEN_RANDOM_SEED 1
+#define GOLDEN_DEFAULT_LEVEL_TOLERANCE_DB 1.
+#define GOLDEN_DEFAULT_SPECTRAL_TOLERANCE_DB 1.5
+// the level is compared in windows of this length
+#define GOLDEN_LEVEL_WINDOW_SECONDS 0.1
+// windows quieter than this in both renders are skipped
+#define GOLDEN_LEVEL_GATE_DB -70.
+#define GOLDEN_FFT_ORDER 12
+// bands this far below the loudest band of both renders are skipped
+#define GOLDEN_SPECTRAL_RANGE_DB 60.
+#define GOLDEN_LOWEST_BAND_HZ 20.
+
+// a spread over oscillator and filter types, fx, the arpeggiator and glide
+static const char *const s_golden_patches[] = {"Factory Presets/Bass/Analog Bass [tx].odin",
+                                               "Factory Presets/Bass/Bass Simple PM [RS].odin",
+                                               "Factory Presets/Bass/Growly FM Bass [XR].odin",
+                                               "Factory Presets/Leads/Filter LFO Lead.odin",
+                                               "Factory Presets/Leads/Glide Comb Lead.odin",
+                                               "Factory Presets/Leads/Drawing Lead.odin",
+                                               "Factory Presets/Keys/FM Piano.odin",
+                                               "Factory Presets/Keys/Metallic Keys [XR].odin",
+                                               "Factory Presets/Pads/Choir Aahs 1 [RS].odin",
+                                               "Factory Presets/Atmospheres/Antarctica [RS].odin",
+                                               "Factory Presets/Chiptune/Chippy.odin",
+                                               "Factory Presets/Organ/Phazzy Organ.odin",
+                                               "Factory Presets/Arps & Sequences/Funk Acid [psylion].odin",
+                                               "Factory Presets/Drums/Kick tekmid.odin"};
+
+// a chord, a line with overlapping notes over the whole velocity range while both wheels move, and a low note
+static MidiMessageSequence createGoldenSequence() {
+	MidiMessageSequence sequence;
+	for (const int note : {48, 55, 60, 64}) {
+		sequence.addEvent(MidiMessage::noteOn(1, note, (uint8)100), 0.);
+		sequence.addEvent(MidiMessage::noteOff(1, note), 1.5);
+	}
+
+	const int line[] = {60, 62, 63, 65, 67, 70, 72, 67};
+	for (int step = 0; step < 8; ++step) {
+		const double time = 1.75 + step * 0.25;
+		sequence.addEvent(MidiMessage::noteOn(1, line[step], (uint8)(40 + step * 12)), time);
+		// the notes overlap, so legato and glide patches slide
+		sequence.addEvent(MidiMessage::noteOff(1, line[step]), time + 0.3);
+	}
+	for (int step = 0; step <= 16; ++step) {
+		const double time = 1.75 + step * 0.125;
+		sequence.addEvent(MidiMessage::controllerEvent(1, 1, step * 127 / 16), time);
+		sequence.addEvent(MidiMessage::pitchWheel(1, jmin(16383, 8192 + step * 512)), time);
+	}
+
+	sequence.addEvent(MidiMessage::controllerEvent(1, 1, 0), 4.);
+	sequence.addEvent(MidiMessage::pitchWheel(1, 8192), 4.);
+	sequence.addEvent(MidiMessage::noteOn(1, 36, (uint8)127), 4.);
+	sequence.addEvent(MidiMessage::noteOff(1, 36), 5.);
+
+	sequence.updateMatchedPairs();
+	return sequence;
+}
+
+static bool renderGolden(const File &p_patch, const RenderSettings &p_settings, AudioBuffer<float> &po_output) {
+	auto processor = createProcessor(p_settings);
+	if (!loadPatch(*processor, p_patch)) {
+		return false;
+	}
+	// the voice modules own their generators, the effects still use rand(), the render should depend on neither
+	processor->seedRandom(GOLDEN_RANDOM_SEED);
+	std::srand(GOLDEN_RANDOM_SEED);
+	RenderPlayHead play_head(p_settings.sample_rate, p_settings.bpm > 0 ? p_settings.bpm : 120.);
+	processor->setPlayHead(&play_head);
+
+	const MidiMessageSequence sequence = createGoldenSequence();
+	po_output.setSize(2, (int)getRenderLength(sequence, p_settings));
+	int position = 0;
+	renderSequence(*processor, play_head, sequence, p_settings, [&](const AudioBuffer<float> &p_block) {
+		for (int channel = 0; channel < 2; ++channel) {
+			po_output.copyFrom(channel, position, p_block, channel, 0, p_block.getNumSamples());
+		}
+		position += p_block.getNumSamples();
+	});
+	processor->releaseResources();
+	return true;
+}
+
+static bool writeWav(const File &p_file, const AudioBuffer<float> &p_buffer, double p_sample_rate) {
+	p_file.deleteFile();
+	std::unique_ptr<FileOutputStream> out_stream = p_file.createOutputStream();
+	WavAudioFormat wav_format;
+	// 32 bit float, so patches louder than full scale are stored as they are
+	std::unique_ptr<AudioFormatWriter> writer(
+	    out_stream ? wav_format.createWriterFor(out_stream.get(), p_sample_rate, 2, 32, {}, 0) : nullptr);
+	if (!writer) {
+		std::fprintf(stderr, "can't write %s\n", p_file.getFullPathName().toRawUTF8());
+		return false;
+	}
+	out_stream.release();
+	return writer->writeFromAudioSampleBuffer(p_buffer, 0, p_buffer.getNumSamples());
+}
+
+static bool readWav(const File &p_file, AudioBuffer<float> &po_buffer, double &po_sample_rate) {
+	WavAudioFormat wav_format;
+	std::unique_ptr<AudioFormatReader> reader(wav_format.createReaderFor(new FileInputStream(p_file), true));
+	if (!reader || reader->numChannels != 2) {
+		std::fprintf(stderr, "can't read %s\n", p_file.getFullPathName().toRawUTF8());
+		return false;
+	}
+	po_sample_rate = reader->sampleRate;
+	po_buffer.setSize(2, (int)reader->lengthInSamples);
+	return reader->read(&po_buffer, 0, (int)reader->lengthInSamples, 0, true, true);
+}
+
+static double levelDb(const AudioBuffer<float> &p_buffer, int p_start, int p_length) {
+	double sum = 0.;
+	for (int channel = 0; channel < 2; ++channel) {
+		const float *data = p_buffer.getReadPointer(channel, p_start);
+		for (int sample = 0; sample < p_length; ++sample) {
+			sum += (double)data[sample] * data[sample];
+		}
+	}
+	return 10. * std::log10(jmax(sum / (2. * p_length), 1e-20));
+}
+
+// largest level difference of the windows in dB, catches changes in envelopes and gain staging
+static double compareLevels(const AudioBuffer<float> &p_reference,
+                            const AudioBuffer<float> &p_render,
+                            double p_sample_rate) {
+	const int window      = jmax(1, (int)(GOLDEN_LEVEL_WINDOW_SECONDS * p_sample_rate));
+	const int num_samples = p_reference.getNumSamples();
+	double difference     = 0.;
+	for (int start = 0; start < num_samples; start += window) {
+		const int length       = jmin(window, num_samples - start);
+		const double reference = jmax(levelDb(p_reference, start, length), GOLDEN_LEVEL_GATE_DB);
+		const double render    = jmax(levelDb(p_render, start, length), GOLDEN_LEVEL_GATE_DB);
+		difference             = jmax(difference, std::abs(reference - render));
+	}
+	return difference;
+}
+
+// average power in third octave bands in dB, from overlapping hann windowed frames of both channels
+static std::vector<double> getBandSpectrum(const AudioBuffer<float> &p_buffer, double p_sample_rate) {
+	const int fft_size = 1 << GOLDEN_FFT_ORDER;
+	dsp::FFT fft(GOLDEN_FFT_ORDER);
+	std::vector<float> window(fft_size);
+	for (int sample = 0; sample < fft_size; ++sample) {
+		window[sample] = 0.5f - 0.5f * std::cos(2.f * MathConstants<float>::pi * sample / fft_size);
+	}
+
+	const double highest_band_hz = jmin(20000., p_sample_rate / 2.);
+	const int num_bands          = (int)(3. * std::log2(highest_band_hz / GOLDEN_LOWEST_BAND_HZ)) + 1;
+	std::vector<double> band_power(num_bands, 0.);
+
+	std::vector<float> frame(2 * fft_size);
+	for (int channel = 0; channel < 2; ++channel) {
+		const float *data = p_buffer.getReadPointer(channel);
+		for (int start = 0; start + fft_size <= p_buffer.getNumSamples(); start += fft_size / 2) {
+			std::fill(frame.begin(), frame.end(), 0.f);
+			for (int sample = 0; sample < fft_size; ++sample) {
+				frame[sample] = data[start + sample] * window[sample];
+			}
+			fft.performFrequencyOnlyForwardTransform(frame.data());
+			for (int bin = 1; bin <= fft_size / 2; ++bin) {
+				const double frequency = bin * p_sample_rate / fft_size;
+				const int band         = (int)(3. * std::log2(frequency / GOLDEN_LOWEST_BAND_HZ));
+				if (band >= 0 && band < num_bands) {
+					band_power[band] += (double)frame[bin] * frame[bin];
+				}
+			}
+		}
+	}
+
+	for (double &power : band_power) {
+		power = 10. * std::log10(jmax(power, 1e-20));
+	}
+	return band_power;
+}
+
+// largest difference of a band in dB, catches changes in filters, oscillator spectra and aliasing
+static double compareSpectra(const AudioBuffer<float> &p_reference,
+                             const AudioBuffer<float> &p_render,
+                             double p_sample_rate) {
+	const std::vector<double> reference = getBandSpectrum(p_reference, p_sample_rate);
+	const std::vector<double> render    = getBandSpectrum(p_render, p_sample_rate);
+
+	double loudest = -1000.;
+	for (size_t band = 0; band < reference.size(); ++band) {
+		loudest = jmax(loudest, reference[band], render[band]);
+	}
+	const double floor = loudest - GOLDEN_SPECTRAL_RANGE_DB;
+
+	double difference = 0.;
+	for (size_t band = 0; band < reference.size(); ++band) {
+		difference = jmax(difference, std::abs(jmax(reference[band], floor) - jmax(render[band], floor)));
+	}
+	return difference;
+}
+
+// level of the difference signal relative to the reference, for information only since any change of phase
+// (e.g. a free running oscillator) makes it large
+static double getResidualDb(const AudioBuffer<float> &p_reference, const AudioBuffer<float> &p_render) {
+	AudioBuffer<float> residual(p_render);
+	for (int channel = 0; channel < 2; ++channel) {
+		residual.addFrom(channel, 0, p_reference, channel, 0, p_reference.getNumSamples(), -1.f);
+	}
+	const int num_samples = p_reference.getNumSamples();
+	return levelDb(residual, 0, num_samples) - levelDb(p_reference, 0, num_samples);
+}
+
+// renders the golden patches with the golden sequence, then stores them in p_directory (p_save) or compares them
+// with the renders stored there
+static int golden(const Array<File> &p_patches,
+                  const File &p_directory,
+                  bool p_save,
+                  const RenderSettings &p_settings,
+                  double p_level_tolerance,
+                  double p_spectral_tolerance) {
+	if (p_save && !p_directory.createDirectory()) {
+		std::fprintf(stderr, "can't create %s\n", p_directory.getFullPathName().toRawUTF8());
+		return 1;
+	}
+
+	int failures = 0;
+	for (const File &patch : p_patches) {
+		const String name    = patch.getFileNameWithoutExtension();
+		const File reference = p_directory.getChildFile(name + ".wav");
+
+		AudioBuffer<float> render;
+		if (!renderGolden(patch, p_settings, render)) {
+			return 1;
+		}
+		if (p_save) {
+			if (!writeWav(reference, render, p_settings.sample_rate)) {
+				return 1;
+			}
+			std::printf("%-40s saved\n", name.toRawUTF8());
+			continue;
+		}
+
+		AudioBuffer<float> expected;
+		double reference_rate = 0.;
+		if (!readWav(reference, expected, reference_rate)) {
+			++failures;
+			continue;
+		}
+		if (reference_rate != p_settings.sample_rate || expected.getNumSamples() != render.getNumSamples()) {
+			std::printf("%-40s FAILED: reference was rendered at %.0f Hz or with a different --tail\n",
+			            name.toRawUTF8(),
+			            reference_rate);
+			++failures;
+			continue;
+		}
+
+		const double level    = compareLevels(expected, render, p_settings.sample_rate);
+		const double spectrum = compareSpectra(expected, render, p_settings.sample_rate);
+		const bool failed     = level > p_level_tolerance || spectrum > p_spectral_tolerance;
+		std::printf("%-40s level %5.2f dB  spectrum %5.2f dB  residual %6.1f dB  %s\n",
+		            name.toRawUTF8(),
+		            level,
+		            spectrum,
+		            getResidualDb(expected, render),
+		            failed ? "FAILED" : "ok");
+		failures += failed ? 1 : 0;
+	}
+
+	if (p_save) {
+		return 0;
+	}
+	if (failures) {
+		std::printf("FAILED: %d of %d patches changed\n", failures, p_patches.size());
+		return 1;
+	}
+	std::printf("passed\n");
+	return 0;
+}
+
+//==============================================================================
+
+int main(int argc, char *argv[]) {
+	ScopedJuceInitialiser_GUI juce_initialiser;
+
+	RenderSettings settings;
+	Array<File> patches;
+	File midi_file, out_file, golden_directory;
+	File soundbanks           = File::getCurrentWorkingDirectory().getChildFile("assets/Soundbanks");
+	bool rt_check             = false;
+	bool golden_save          = false;
+	double level_tolerance    = GOLDEN_DEFAULT_LEVEL_TOLERANCE_DB;
+	double spectral_tolerance = GOLDEN_DEFAULT_SPECTRAL_TOLERANCE_DB;
+
+	for (int arg = 1; arg < argc; ++arg) {
+		const String name    = argv[arg];
+		const bool has_value = arg + 1 < argc;
+		const String value   = has_value ? String(argv[arg + 1]) : String();
+		if (name == "--rt-check") {
+			rt_check = true;
+			continue;
+		}
+		if (!has_value) {
+			printUsage();
+			return 1;
+		}
+		++arg;
+		if (name == "--patch") {
+			patches.add(File::getCurrentWorkingDirectory().getChildFile(value));
+		} else if (name == "--midi") {
+			midi_file = File::getCurrentWorkingDirectory().getChildFile(value);
+		} else if (name == "--out") {
+			out_file = File::getCurrentWorkingDirectory().getChildFile(value);
+		} else if (name == "--rate") {
+			settings.sample_rate = value.getDoubleValue();
+		} else if (name == "--block") {
+			settings.block_size = value.getIntValue();
+		} else if (name == "--tail") {
+			settings.tail_seconds = value.getDoubleValue();
+		} else if (name == "--bits") {
+			settings.bit_depth = value.getIntValue();
+		} else if (name == "--bpm") {
+			settings.bpm = value.getDoubleValue();
+		} else if (name == "--polyphony") {
+			settings.polyphony = value.getIntValue();
+		} else if (name == "--control-rate") {
+			settings.control_rate = value.getIntValue();
+		} else if (name == "--multi-core") {
+			settings.multi_core = value.getIntValue();
+		} else if (name == "--quality" && (value == "eco" || value == "high")) {
+			settings.offline = value == "high";
+		} else if (name == "--golden-save" || name == "--golden-check") {
+			golden_directory = File::getCurrentWorkingDirectory().getChildFile(value);
+			golden_save      = name == "--golden-save";
+		} else if (name == "--soundbanks") {
+			soundbanks = File::getCurrentWorkingDirectory().getChildFile(value);
+		} else if (name == "--level-tolerance") {
+			level_tolerance = value.getDoubleValue();
+		} else if (name == "--spectral-tolerance") {
+			spectral_tolerance = value.getDoubleValue();
+		} else {
+			printUsage();
+			return 1;
+		}
+	}
+
+	if (settings.sample_rate <= 0. || settings.block_size <= 0 || settings.tail_seconds < 0.) {
+		printUsage();
+		return 1;
+	}
+	if (rt_check) {
+		return rtCheck(patches, settings);
+	}
+	if (golden_directory != File()) {
+		// the renders should not depend on the config file of the machine
+		settings.polyphony    = settings.polyphony > 0 ? settings.polyphony : VOICES_DEFAULT;
+		settings.control_rate = settings.control_rate > 0 ? settings.control_rate : CONTROL_RATE_DEFAULT;
+		settings.multi_core   = jmax(settings.multi_core, 0);
+		if (patches.isEmpty()) {
+			for (const char *patch : s_golden_patches) {
+				patches.add(soundbanks.getChildFile(patch));
+			}
+		}
+		return golden(patches, golden_directory, golden_save, settings, level_tolerance, spectral_tolerance);
+	}
+	if (patches.size() != 1 || midi_file == File() || out_file == File()) {
+		printUsage();
+		return 1;
+	}
+	return render(patches[0], midi_file, out_file, settings);
+}
@@ -0,0 +1,127 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+// odin2-wavetables: writes the factory wavetables to the binary resource which builds with
+// -DODIN2_WAVETABLE_RESOURCE=ON embed instead of compiling WavetableData.cpp, built with
+// -DODIN2_BUILD_WAVETABLE_TOOL=ON. Run it with --help for the usage.
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "../audio/Oscillators/WavetableResource.h"
+#include "../audio/Oscillators/Wavetables/Tables/WavetableData.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+static void printUsage() {
+	std::printf("usage: odin2-wavetables --out <file> [--format <float|int16|half>]\n"
+	            "\n"
+	            "Writes the factory wavetables to <file>, float (default) keeps them exact, int16 and half take half\n"
+	            "the space. Put the resource at assets/Wavetables/wavetables.bin and configure with\n"
+	            "-DODIN2_WAVETABLE_RESOURCE=ON to build the plugin with it. The resource has to be written again\n"
+	            "whenever the tables change. Fails if the tables read back from <file> are further off than the\n"
+	            "format allows (float: exact, int16: -80 dB, half: -60 dB).\n");
+}
+
+// the largest error a format may have after reading it back. float is exact, int16 rounds to 16 bits of the peak of
+// its subtable and half keeps 11 significant bits
+static double getErrorLimitDB(WavetableResource::Format p_format) {
+	switch (p_format) {
+	case WavetableResource::Int16:
+		return -80.;
+	case WavetableResource::Half:
+		return -60.;
+	default:
+		return -INFINITY;
+	}
+}
+
+int main(int argc, char *argv[]) {
+	ScopedJuceInitialiser_GUI juce_initialiser;
+
+	File out_file;
+	WavetableResource::Format format = WavetableResource::Float32;
+
+	for (int arg = 1; arg + 1 < argc; arg += 2) {
+		const String name  = argv[arg];
+		const String value = argv[arg + 1];
+		if (name == "--out") {
+			out_file = File::getCurrentWorkingDirectory().getChildFile(value);
+		} else if (name == "--format" && value == "float") {
+			format = WavetableResource::Float32;
+		} else if (name == "--format" && value == "int16") {
+			format = WavetableResource::Int16;
+		} else if (name == "--format" && value == "half") {
+			format = WavetableResource::Half;
+		} else {
+			printUsage();
+			return 1;
+		}
+	}
+	if (out_file == File() || argc % 2 == 0) {
+		printUsage();
+		return 1;
+	}
+
+	std::vector<const float *> subtables;
+	for (int wavetable = 0; wavetable < NUMBER_OF_WAVETABLES; ++wavetable) {
+		for (int subtable = 0; subtable < SUBTABLES_PER_WAVETABLE; ++subtable) {
+			subtables.push_back(getOneSubTable(wavetable, subtable));
+		}
+	}
+
+	out_file.getParentDirectory().createDirectory();
+	out_file.deleteFile();
+	{
+		FileOutputStream stream(out_file);
+		if (!stream.openedOk() || !WavetableResource::write(stream, subtables.data(), format)) {
+			std::printf("could not write %s\n", out_file.getFullPathName().toRawUTF8());
+			return 1;
+		}
+	}
+
+	// read it back the way the plugin does, so a broken resource never makes it into a build
+	MemoryBlock resource;
+	std::vector<float> tables(WAVETABLE_RESOURCE_NUM_SAMPLES);
+	if (!out_file.loadFileAsData(resource) ||
+	    !WavetableResource::read(resource.getData(), resource.getSize(), tables.data())) {
+		std::printf("could not read back %s\n", out_file.getFullPathName().toRawUTF8());
+		return 1;
+	}
+	float max_error = 0.f;
+	for (int subtable = 0; subtable < WAVETABLE_RESOURCE_NUM_SUBTABLES; ++subtable) {
+		for (int sample = 0; sample < WAVETABLE_LENGTH; ++sample) {
+			const float error = fabsf(tables[subtable * WAVETABLE_LENGTH + sample] - subtables[subtable][sample]);
+			max_error         = jmax(max_error, error);
+		}
+	}
+
+	const double max_error_dB = max_error > 0.f ? 20. * log10((double)max_error) : -INFINITY;
+
+	std::printf("wrote %s: %d subtables, %s, %.1f MB, largest error %.1f dB\n",
+	            out_file.getFullPathName().toRawUTF8(),
+	            WAVETABLE_RESOURCE_NUM_SUBTABLES,
+	            WavetableResource::getFormatName(format),
+	            (double)resource.getSize() / (1024. * 1024.),
+	            max_error_dB);
+	if (max_error_dB > getErrorLimitDB(format)) {
+		std::printf("FAILED: the error is above the limit of %.1f dB for %s\n",
+		            getErrorLimitDB(format),
+		            WavetableResource::getFormatName(format));
+		out_file.deleteFile();
+		return 1;
+	}
+	return 0;
+}